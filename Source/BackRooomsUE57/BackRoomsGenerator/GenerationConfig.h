@@ -167,17 +167,122 @@ struct FBackroomGenerationConfig
 	          meta = (ClampMin = "2.0", ClampMax = "20.0", Units = "m"))
 	float MaxStairHeight = 6.0f;
 
+	// === PERFORMANCE SETTINGS ===
+
+	// Build each room as one actor with a mesh section per wall/floor instead of one actor per wall
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	bool bMergeRoomMeshes = false;
+
+	// Concatenate all rooms in an XY cell into one mesh per material (overrides bMergeRoomMeshes)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	bool bUseChunkMeshes = false;
+
+	UPROPERTY(EditAnywhere,
+	          BlueprintReadWrite,
+	          Category = "Performance",
+	          meta = (ClampMin = "10.0", ClampMax = "500.0", Units = "m", EditCondition = "bUseChunkMeshes"))
+	float ChunkSize = 50.0f;
+
+	// Draw solid walls and floors as instances of one unit-box mesh (only holed walls are procedural)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	bool bInstanceSolidWalls = false;
+
+	// Collide against per-wall boxes instead of cooking every wall mesh as complex (trimesh) collision
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	bool bSimpleWallCollision = true;
+
+	// Resolve the whole layout and every connection before building any wall, so each wall is built exactly once
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	bool bTwoPhaseRoomBuild = true;
+
+	// Two-phase build only: adjacent rooms share one wall per seam, with every opening cut into that wall
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	bool bShareAdjacentWalls = true;
+
+	// Queue procedural wall meshes during placement and build them for all rooms in parallel afterwards
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	bool bParallelMeshBuild = false;
+
+	// Cook wall collision off the game thread - rooms report ready (OnRoomReady) once their cooks finish
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	bool bAsyncCollisionCooking = true;
+
+	// Seconds a room may wait for its collision cooks before it is reported ready anyway
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.1", EditCondition = "bAsyncCollisionCooking"))
+	float CollisionCookTimeout = 10.0f;
+
+	// Park released wall actors and re-mesh them in place instead of destroying and respawning (individual walls)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	bool bPoolWallActors = true;
+
+	// Give every room a box-shell proxy and draw distant rooms with it (not available with chunk meshes)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	bool bRoomProxyLod = true;
+
+	// Measure rooms by distance to the viewer or by connections from the viewer's room
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (EditCondition = "bRoomProxyLod"))
+	ERoomLodMetric RoomLodMetric = ERoomLodMetric::Distance;
+
+	UPROPERTY(EditAnywhere,
+	          BlueprintReadWrite,
+	          Category = "Performance",
+	          meta = (ClampMin = "5.0", ClampMax = "500.0", Units = "m", EditCondition = "bRoomProxyLod"))
+	float RoomLodDistance = 40.0f; // Rooms farther than this are drawn as proxies
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0", ClampMax = "20", EditCondition = "bRoomProxyLod"))
+	int32 RoomLodHops = 2; // Rooms more connections away than this are drawn as proxies
+
+	UPROPERTY(EditAnywhere,
+	          BlueprintReadWrite,
+	          Category = "Performance",
+	          meta = (ClampMin = "0.05", ClampMax = "2.0", Units = "s", EditCondition = "bRoomProxyLod"))
+	float RoomLodUpdateInterval = 0.25f;
+
+	// Reuse the last solved layout from disk when its layout settings and seed match, skipping room placement
+	// Off by default so every run solves a new layout; with LayoutSeed 0 the first solved layout is kept
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	bool bCacheLayout = false;
+
+	// Seeds room selection, room sizes and connection types and widths (0 = a new random layout every run)
+	// A cached layout is only reused for the same seed - change it to solve (and cache) a new layout
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	int32 LayoutSeed = 0;
+
+	// Layout file, relative to the project's Saved directory
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (EditCondition = "bCacheLayout"))
+	FString LayoutCacheFile = TEXT("BackRooms/Layout.bin");
+
 	// === LOGGING SETTINGS ===
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
 	bool bShowRoomNumbers = true;
 
+	// Room number labels farther than this from the viewer are hidden and not turned (0 = no limit)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.0", Units = "m", EditCondition = "bShowRoomNumbers"))
+	float RoomLabelVisibilityRadius = 30.0f;
+
+	// Draw room numbers as instanced digit bars of one shared component instead of a text actor per room
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (EditCondition = "bShowRoomNumbers"))
+	bool bBatchedRoomNumbers = true;
+
+	// Draw hallway / stair / identifier spheres (one instanced overlay; hidden markers spawn nothing until shown)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+	bool bShowDebugMarkers = true;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
 	bool bVerboseLogging = false;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug", meta = (ClampMin = "10", ClampMax = "1000"))
 	int32 LoggingInterval = 50; // Log every N iterations
 
+	// Log collision setup time and time a set of character-sized capsule sweeps after generation
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+	bool bMeasureCollisionCost = false;
+
+	// Log a per-vertex vs batch wall transform timing after generation
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+	bool bBenchmarkWallTransform = false;
+
 	// === VALIDATION ===
 
 	// Validate that ratios sum to approximately 1.0
@@ -206,6 +311,27 @@ struct FBackroomGenerationConfig
 		}
 	}
 
+	// Hash of every setting that shapes the layout (room mix, sizes, spacing, connections, safety limits)
+	// Build, render and debug settings are left out, so changing them keeps a cached layout valid
+	uint32 GetLayoutHash() const
+	{
+		uint32 Hash = GetTypeHash(TotalRooms);
+		for (const int32 Value : { MaxAttemptsPerConnection, MaxConnectionRetries, MaxSafetyIterations })
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Value));
+		}
+		for (const float Value : { RoomRatio, HallwayRatio, StairRatio, MaxGenerationTime,
+		                           StandardRoomHeight, WallThickness, CollisionBuffer,
+		                           DoorwayConnectionRatio, StandardDoorwayWidth, StandardDoorwayHeight,
+		                           MinRoomSize, MaxRoomSize, MinHallwayWidth, MaxHallwayWidth, MinHallwayLength, MaxHallwayLength,
+		                           ShortHallwayRatio, MediumHallwayRatio, LongHallwayRatio, MediumHallwayThreshold, LongHallwayThreshold,
+		                           MinStairHeight, MaxStairHeight })
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Value));
+		}
+		return Hash;
+	}
+
 	// Default constructor with sensible defaults
 	FBackroomGenerationConfig()
 	{
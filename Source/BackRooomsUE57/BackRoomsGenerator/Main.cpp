@@ -1,19 +1,32 @@
 #include "Main.h"
 #include "RoomUnit/BaseRoom.h"
 #include "RoomUnit/StandardRoom.h"
+#include "RoomUnit/StairsRoom.h"
+#include "RoomUnit/BillboardLabelSubsystem.h"
+#include "RoomUnit/StairTemplateCache.h"
 #include "TestGenerator.h"
+#include "WallUnit/WallGeometryCache.h"
+#include "WallUnit/WallUnit.h"
+#include "WallUnit/WallTransform.h"
+#include "WallUnit/WallMaterialCache.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
 #include "Engine/World.h"
-#include "Components/StaticMeshComponent.h"
 #include "Components/TextRenderComponent.h"
-#include "Engine/StaticMesh.h"
 #include "DrawDebugHelpers.h"
-#include "Materials/MaterialInstanceDynamic.h"
 #include "ProceduralMeshComponent.h"
+#include "TimerManager.h"
+#include "Misc/Paths.h"
 
 DEFINE_LOG_CATEGORY(LogBackRoomGenerator);
 
+namespace
+{
+	// Generators that have begun play - the process-wide caches are shared by all of them (game thread only)
+	int32 NumPlayingGenerators = 0;
+}
+
 ABackRoomGenerator::ABackRoomGenerator()
 {
 	PrimaryActorTick.bCanEverTick = false;
@@ -26,6 +39,15 @@ ABackRoomGenerator::ABackRoomGenerator()
 	CollisionService = MakeUnique<FCollisionDetectionService>();
 	ConnectionManager = MakeUnique<FRoomConnectionManager>();
 	GenerationOrchestrator = MakeUnique<FGenerationOrchestrator>();
+	ChunkBuilder = MakeUnique<FChunkMeshBuilder>();
+	InstancedWallRenderer = MakeUnique<FInstancedWallRenderer>();
+	MeshBatchBuilder = MakeUnique<FRoomMeshBatchBuilder>();
+	CookTracker = MakeUnique<FCollisionCookTracker>();
+	WallActorPool = MakeUnique<FWallActorPool>();
+	WallGraphResolver = MakeUnique<FWallGraphResolver>();
+	DebugMarkerOverlay = MakeUnique<FDebugMarkerOverlay>();
+	LayoutCache = MakeUnique<FLayoutCache>();
+	RoomLodManager = MakeUnique<FRoomLodManager>();
 	
 	// Configuration is set via GenerationConfig.h defaults (currently 4 rooms for testing)
 }
@@ -33,12 +55,28 @@ ABackRoomGenerator::ABackRoomGenerator()
 void ABackRoomGenerator::BeginPlay()
 {
 	Super::BeginPlay();
+	NumPlayingGenerators++;
 	
 	// Auto-generate immediately using procedural generation
 	GenerateProceduralRooms(); // ENABLED - normal backrooms generation with boundary fix
 	// GenerateBackroomsInTestMode(); // DISABLED - use TestGenerator for stair testing
 }
 
+void ABackRoomGenerator::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Cached wall materials are rooted, release them before the world goes away (PIE sessions share the process)
+	// Other generators still use the shared caches, so only the last one to leave clears them
+	NumPlayingGenerators = FMath::Max(NumPlayingGenerators - 1, 0);
+	if (NumPlayingGenerators == 0)
+	{
+		UWallMaterialCache::Reset();
+		UWallGeometryCache::Reset();
+		UStairTemplateCache::Reset();
+	}
+	
+	Super::EndPlay(EndPlayReason);
+}
+
 void ABackRoomGenerator::GenerateBackrooms()
 {
 	// Clear any existing rooms and pre-allocate memory
@@ -97,42 +135,209 @@ void ABackRoomGenerator::GenerateProceduralRooms()
 		}
 	}
 	
-	// Create initial room
-	FRoomData InitialRoom = CreateInitialRoom(CharacterLocation);
-	
-	// Use the Generation Orchestrator service to handle the main generation loop
-	int32 GeneratedCount = GenerationOrchestrator->ExecuteProceduralGeneration(
-		InitialRoom,
-		GeneratedRooms,
-		Config,
-		CollisionService.Get(),
-		ConnectionManager.Get(),
-		[this](FRoomData& Room) {
-			// Room creator function - create the actual UE room unit
-			UStandardRoom* RoomUnit = NewObject<UStandardRoom>(this);
-			if (RoomUnit && RoomUnit->CreateFromRoomData(Room, this, Config.bShowRoomNumbers))
+	// Fresh geometry cache and collision statistics for this layout
+	UWallGeometryCache::Reset();
+	UWallMaterialCache::Reset();
+	UStairTemplateCache::Reset();
+	UWallUnit::ResetCollisionSetupStats();
+	
+	// Chunk meshes and wall instances are shared by every room of this layout
+	if (Config.bUseChunkMeshes)
+	{
+		ChunkBuilder->Initialize(GetWorld(), Config.ChunkSize, Config.bAsyncCollisionCooking);
+	}
+	if (Config.bInstanceSolidWalls)
+	{
+		InstancedWallRenderer->Initialize(GetWorld());
+	}
+	MeshBatchBuilder->Initialize();
+	CookTracker->Initialize();
+	WallActorPool->Initialize();
+	DebugMarkerOverlay->Initialize(GetWorld(), Config.bShowDebugMarkers);
+	ReadyRoomIndices.Empty();
+	GetWorldTimerManager().ClearTimer(RoomReadyTimer);
+	RoomLodManager->Initialize();
+	GetWorldTimerManager().ClearTimer(RoomLodTimer);
+	if (UBillboardLabelSubsystem* LabelSubsystem = GetWorld()->GetSubsystem<UBillboardLabelSubsystem>())
+	{
+		LabelSubsystem->ResetNumberLabels();
+		LabelSubsystem->SetVisibilityRadius(MetersToUnrealUnits(Config.RoomLabelVisibilityRadius));
+	}
+	
+	// Room creator - create the actual UE room unit for a placed room (SourceRoom = the room it was placed from)
+	auto CreateRoomUnit = [this](FRoomData& Room, const FRoomData& SourceRoom) {
+		// Stair rooms get their steps (and stair collision) from UStairsRoom, every other room is a plain box
+		UStairsRoom* StairsUnit = Room.Category == ERoomCategory::Stairs ? NewObject<UStairsRoom>(this) : nullptr;
+		UStandardRoom* RoomUnit = StairsUnit ? StairsUnit : NewObject<UStandardRoom>(this);
+		if (RoomUnit)
+		{
+			ApplyRoomBuildMode(RoomUnit);
+		}
+		const bool bCreated = StairsUnit
+			? StairsUnit->CreateFromLayout(Room, SourceRoom.Elevation, this, Config.bShowRoomNumbers)
+			: RoomUnit && RoomUnit->CreateFromRoomData(Room, this, Config.bShowRoomNumbers);
+		if (bCreated)
+		{
+			Room.RoomUnit = RoomUnit;
+			RoomUnits.Add(RoomUnit);
+		}
+	};
+	
+	// A cached layout solved with the same settings and seed skips placement - only its rooms and holes are built
+	const FString LayoutFilePath = FPaths::Combine(FPaths::ProjectSavedDir(), Config.LayoutCacheFile);
+	const uint32 LayoutHash = Config.GetLayoutHash();
+	bool bLayoutFromCache = false;
+	int32 GeneratedCount = 0;
+	if (Config.bCacheLayout && LayoutCache->LoadLayout(LayoutFilePath, LayoutHash, Config.LayoutSeed, 
+		GetInitialRoomPosition(CharacterLocation), GeneratedRooms))
+	{
+		bLayoutFromCache = true;
+		
+		// The layout is rebased on this session's initial room, which gets the same setup as in a solved layout
+		BuildInitialRoom(GeneratedRooms[0]);
+		for (int32 RoomIndex = 1; RoomIndex < GeneratedRooms.Num(); RoomIndex++)
+		{
+			// Rooms are stored in placement order, so the only earlier room linked to this one is the one it was placed from
+			FRoomData& Room = GeneratedRooms[RoomIndex];
+			const FRoomData* SourceRoom = &GeneratedRooms[0];
+			for (int32 EarlierIndex = 0; EarlierIndex < RoomIndex; EarlierIndex++)
 			{
-				Room.RoomUnit = RoomUnit;
-				RoomUnits.Add(RoomUnit);
+				const bool bLinked = GeneratedRooms[EarlierIndex].Connections.ContainsByPredicate([&Room](const FRoomConnection& Connection) {
+					return Connection.ConnectedRoomIndex == Room.RoomIndex;
+				});
+				if (bLinked)
+				{
+					SourceRoom = &GeneratedRooms[EarlierIndex];
+					break;
+				}
 			}
+			CreateRoomUnit(Room, *SourceRoom);
 		}
-	);
+		for (FRoomData& Room : GeneratedRooms)
+		{
+			ConnectionManager->RebuildPhysicalConnections(Room);
+		}
+		GeneratedCount = GeneratedRooms.Num();
+		
+		int64 FileBytes;
+		double LoadSeconds;
+		LayoutCache->GetCacheStats(FileBytes, LoadSeconds);
+		DebugLog(FString::Printf(TEXT("💾 Layout cache hit: %d rooms read from %s (%.1f KB) in %.2f ms, placement skipped"), 
+			GeneratedCount, *LayoutFilePath, FileBytes / 1024.0, LoadSeconds * 1000.0));
+	}
+	else
+	{
+		// Create initial room
+		FRoomData InitialRoom = CreateInitialRoom(CharacterLocation);
+		
+		// Use the Generation Orchestrator service to handle the main generation loop
+		GeneratedCount = GenerationOrchestrator->ExecuteProceduralGeneration(
+			InitialRoom,
+			GeneratedRooms,
+			Config,
+			CollisionService.Get(),
+			ConnectionManager.Get(),
+			CreateRoomUnit
+		);
+		
+		// Layouts cut short by the safety limits are not worth reusing
+		if (Config.bCacheLayout && !GenerationOrchestrator->WasStoppedBySafety()
+			&& LayoutCache->SaveLayout(LayoutFilePath, LayoutHash, Config.LayoutSeed, GeneratedRooms))
+		{
+			int64 FileBytes;
+			double SaveSeconds;
+			LayoutCache->GetCacheStats(FileBytes, SaveSeconds);
+			DebugLog(FString::Printf(TEXT("💾 Layout cached: %d rooms written to %s (%.1f KB)"), 
+				GeneratedRooms.Num(), *LayoutFilePath, FileBytes / 1024.0));
+		}
+	}
+	
+	// Phase two: the layout and all connections are final, build every wall once
+	if (Config.bTwoPhaseRoomBuild)
+	{
+		// Walls facing each other across a seam become one wall owned by one of the rooms
+		if (Config.bShareAdjacentWalls)
+		{
+			WallGraphResolver->ResolveSharedWalls(GeneratedRooms, Config.WallThickness);
+			int32 Seams, DroppedWalls, MergedOpenings;
+			WallGraphResolver->GetGraphStats(Seams, DroppedWalls, MergedOpenings);
+			DebugLog(FString::Printf(TEXT("🔗 Shared walls: %d seams built once, %d duplicate walls skipped, %d openings cut into one wall"), 
+				Seams, DroppedWalls, MergedOpenings));
+		}
+		
+		int32 SupersededEdits = 0;
+		for (UStandardRoom* RoomUnit : RoomUnits)
+		{
+			SupersededEdits += RoomUnit->BuildDeferredGeometry(this);
+		}
+		DebugLog(FString::Printf(TEXT("🧩 Two-phase build: %d rooms built once, %d superseded wall edits skipped"), 
+			RoomUnits.Num(), SupersededEdits));
+	}
+	
+	// Build queued wall meshes and chunk meshes once all rooms and their connections exist
+	SubmitQueuedRoomMeshes();
+	RebuildDirtyChunks();
+	WaitForRoomCollision();
+	
+	// Distant rooms swap to their box-shell proxies (chunks mix rooms, so they have no per-room LOD)
+	if (Config.bRoomProxyLod && !Config.bUseChunkMeshes)
+	{
+		for (const FRoomData& Room : GeneratedRooms)
+		{
+			RegisterRoomLod(Room);
+		}
+		UpdateRoomLod();
+		GetWorldTimerManager().SetTimer(RoomLodTimer, this, &ABackRoomGenerator::UpdateRoomLod, Config.RoomLodUpdateInterval, true);
+	}
+	
+	if (Config.bInstanceSolidWalls)
+	{
+		int32 NumInstances, NumComponents;
+		InstancedWallRenderer->GetInstanceStats(NumInstances, NumComponents);
+		DebugLog(FString::Printf(TEXT("🧱 Instanced solid walls: %d instances in %d components"), NumInstances, NumComponents));
+	}
+	
+	UBillboardLabelSubsystem* LabelSubsystem = GetWorld()->GetSubsystem<UBillboardLabelSubsystem>();
+	if (Config.bShowRoomNumbers && Config.bBatchedRoomNumbers && LabelSubsystem)
+	{
+		int32 NumLabels, NumVisible, NumBars;
+		LabelSubsystem->GetLabelStats(NumLabels, NumVisible, NumBars);
+		DebugLog(FString::Printf(TEXT("🔢 Room numbers: %d labels as %d instanced digit bars in one component"), NumLabels, NumBars));
+	}
 	
-	// Get generation statistics
-	int32 MainLoops, ConnectionRetries, PlacementAttempts;
-	double ElapsedTime;
-	GenerationOrchestrator->GetGenerationStats(MainLoops, ConnectionRetries, PlacementAttempts, ElapsedTime);
+	if (Config.bShowDebugMarkers)
+	{
+		int32 NumMarkers, NumMarkerComponents;
+		DebugMarkerOverlay->GetMarkerStats(NumMarkers, NumMarkerComponents);
+		DebugLog(FString::Printf(TEXT("📍 Debug markers: %d markers in %d instanced components"), NumMarkers, NumMarkerComponents));
+	}
 	
-	// Log summary
-	DebugLog(FString::Printf(TEXT("✅ GENERATION COMPLETED: %d/%d rooms generated"), 
-		GeneratedCount, Config.TotalRooms));
-	DebugLog(FString::Printf(TEXT("⏱️  Generation took %.2f seconds"), ElapsedTime));
-	DebugLog(FString::Printf(TEXT("🔄 Loop counters: Main=%d, Connection=%d, Placement=%d"), 
-		MainLoops, ConnectionRetries, PlacementAttempts));
+	if (Config.bPoolWallActors && !Config.bMergeRoomMeshes && !Config.bUseChunkMeshes)
+	{
+		int32 Spawned, Reused, Released, Parked;
+		WallActorPool->GetPoolStats(Spawned, Reused, Released, Parked);
+		DebugLog(FString::Printf(TEXT("♻️ Wall actor pool: %d spawned, %d re-meshed in place, %d released, %d parked"), 
+			Spawned, Reused, Released, Parked));
+	}
 	
-	if (GenerationOrchestrator->WasStoppedBySafety())
+	// Get generation statistics (placement only ran without a cached layout)
+	if (!bLayoutFromCache)
 	{
-		DebugLog(TEXT("⚠️  Generation stopped due to safety limits"));
+		int32 MainLoops, ConnectionRetries, PlacementAttempts;
+		double ElapsedTime;
+		GenerationOrchestrator->GetGenerationStats(MainLoops, ConnectionRetries, PlacementAttempts, ElapsedTime);
+		
+		// Log summary
+		DebugLog(FString::Printf(TEXT("✅ GENERATION COMPLETED: %d/%d rooms generated"), 
+			GeneratedCount, Config.TotalRooms));
+		DebugLog(FString::Printf(TEXT("⏱️  Generation took %.2f seconds"), ElapsedTime));
+		DebugLog(FString::Printf(TEXT("🔄 Loop counters: Main=%d, Connection=%d, Placement=%d"), 
+			MainLoops, ConnectionRetries, PlacementAttempts));
+		
+		if (GenerationOrchestrator->WasStoppedBySafety())
+		{
+			DebugLog(TEXT("⚠️  Generation stopped due to safety limits"));
+		}
 	}
 	
 	// Ensure we don't have more rooms than intended
@@ -142,6 +347,29 @@ void ABackRoomGenerator::GenerateProceduralRooms()
 			GeneratedRooms.Num(), Config.TotalRooms));
 	}
 	
+	// Wall geometry reuse (hit rate / bytes not rebuilt)
+	UWallGeometryCache::LogStats();
+	UWallMaterialCache::LogStats();
+	UStairTemplateCache::LogStats();
+	if (Config.bBenchmarkWallTransform)
+	{
+		UWallTransform::LogBenchmark(100000, 20);
+	}
+	
+	if (Config.bMeasureCollisionCost)
+	{
+		int32 Uploads;
+		double CollisionSeconds;
+		UWallUnit::GetCollisionSetupStats(Uploads, CollisionSeconds);
+		DebugLog(FString::Printf(TEXT("🧱 Wall collision (%s): %d section uploads, %.1f ms upload + cook on the game thread"), 
+			Config.bSimpleWallCollision ? TEXT("simple boxes") : TEXT("complex trimesh"), Uploads, CollisionSeconds * 1000.0));
+		if (!Config.bAsyncCollisionCooking)
+		{
+			// Async cooks are still running - the sweeps run once every room is ready
+			MeasureCollisionSweeps();
+		}
+	}
+	
 	// Print comprehensive room size summary
 	UE_LOG(LogTemp, Warning, TEXT("🚀 About to call PrintRoomSizeSummary()..."));
 	PrintRoomSizeSummary();
@@ -181,13 +409,30 @@ FRoomData ABackRoomGenerator::CreateInitialRoom(const FVector& CharacterLocation
 	InitialRoom.Height = Config.StandardRoomHeight;
 	InitialRoom.RoomIndex = 0;
 	
+	InitialRoom.Position = GetInitialRoomPosition(CharacterLocation);
+	BuildInitialRoom(InitialRoom);
+	
+	// Create connections for all 4 walls
+	ConnectionManager->CreateRoomConnections(InitialRoom, Config);
+	
+	DebugLog(FString::Printf(TEXT("Created initial room (%.1fx%.1fm) at %s"), 
+		InitialRoom.Width, InitialRoom.Length, *InitialRoom.Position.ToString()));
+	
+	return InitialRoom;
+}
+
+FVector ABackRoomGenerator::GetInitialRoomPosition(const FVector& CharacterLocation) const
+{
 	// Position room so character stands on the floor surface  
-	InitialRoom.Position = FVector(
-		CharacterLocation.X - MetersToUnrealUnits(InitialRoom.Width) * 0.5f,
-		CharacterLocation.Y - MetersToUnrealUnits(InitialRoom.Length) * 0.5f,
+	return FVector(
+		CharacterLocation.X - MetersToUnrealUnits(BackroomConstants::INITIAL_ROOM_SIZE) * 0.5f,
+		CharacterLocation.Y - MetersToUnrealUnits(BackroomConstants::INITIAL_ROOM_SIZE) * 0.5f,
 		CharacterLocation.Z - MetersToUnrealUnits(BackroomConstants::INITIAL_ROOM_FLOOR_OFFSET) // Room floor offset below character
 	);
-	
+}
+
+void ABackRoomGenerator::BuildInitialRoom(FRoomData& InitialRoom)
+{
 	// Create the actual room unit using new architecture
 	UStandardRoom* InitialRoomUnit = NewObject<UStandardRoom>(this);
 	InitialRoomUnit->Width = InitialRoom.Width;
@@ -196,6 +441,7 @@ FRoomData ABackRoomGenerator::CreateInitialRoom(const FVector& CharacterLocation
 	InitialRoomUnit->Position = InitialRoom.Position;
 	InitialRoomUnit->RoomCategory = InitialRoom.Category;
 	InitialRoomUnit->Elevation = InitialRoom.Elevation;
+	ApplyRoomBuildMode(InitialRoomUnit);
 	
 	InitialRoom.RoomUnit = InitialRoomUnit;
 	InitialRoom.RoomUnit->CreateRoom(this);
@@ -205,9 +451,6 @@ FRoomData ABackRoomGenerator::CreateInitialRoom(const FVector& CharacterLocation
 	// Add room number identifier
 	CreateRoomNumberIdentifier(InitialRoom);
 	
-	// Create connections for all 4 walls
-	ConnectionManager->CreateRoomConnections(InitialRoom, Config);
-	
 	// Position character above the room floor
 	if (UWorld* World = GetWorld())
 	{
@@ -224,11 +467,6 @@ FRoomData ABackRoomGenerator::CreateInitialRoom(const FVector& CharacterLocation
 			}
 		}
 	}
-	
-	DebugLog(FString::Printf(TEXT("Created initial room (%.1fx%.1fm) at %s"), 
-		InitialRoom.Width, InitialRoom.Length, *InitialRoom.Position.ToString()));
-	
-	return InitialRoom;
 }
 
 FRoomData ABackRoomGenerator::GenerateRandomRoom(ERoomCategory Category, int32 RoomIndex)
@@ -341,6 +579,23 @@ void ABackRoomGenerator::CreateRoomNumberIdentifier(const FRoomData& Room)
 {
 	if (!Room.RoomUnit) return;
 	
+	// Position above room center
+	FVector RoomCenter = Room.Position + FVector(
+		MetersToUnrealUnits(Room.Width) * 0.5f,
+		MetersToUnrealUnits(Room.Length) * 0.5f,
+		MetersToUnrealUnits(Room.Height) + MetersToUnrealUnits(1.5f) // 1.5m above room
+	);
+	
+	// Batched: same shared digit bars as every other room label (1-based like them), no component
+	UBillboardLabelSubsystem* LabelSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UBillboardLabelSubsystem>() : nullptr;
+	if (Config.bBatchedRoomNumbers && LabelSubsystem)
+	{
+		LabelSubsystem->AddNumberLabel(RoomCenter, Room.RoomIndex + 1, 200.0f);
+		DebugLog(FString::Printf(TEXT("Added batched room number label '%d' at %s"), 
+			Room.RoomIndex + 1, *RoomCenter.ToString()));
+		return;
+	}
+	
 	// Create text render component for the room number
 	UTextRenderComponent* NumberText = NewObject<UTextRenderComponent>(this, 
 		*FString::Printf(TEXT("RoomNumberText_%d"), Room.RoomIndex));
@@ -364,13 +619,6 @@ void ABackRoomGenerator::CreateRoomNumberIdentifier(const FRoomData& Room)
 	NumberText->SetupAttachment(GetRootComponent());
 	NumberText->RegisterComponent();
 	
-	// Position above room center
-	FVector RoomCenter = Room.Position + FVector(
-		MetersToUnrealUnits(Room.Width) * 0.5f,
-		MetersToUnrealUnits(Room.Length) * 0.5f,
-		MetersToUnrealUnits(Room.Height) + MetersToUnrealUnits(1.5f) // 1.5m above room
-	);
-	
 	NumberText->SetWorldLocation(RoomCenter);
 	
 	// Make text vertical (standing upright) - no rotation needed for vertical text
@@ -451,6 +699,12 @@ void ABackRoomGenerator::CreateConnectionInRoomWallWithThickness(FRoomData& Room
 	
 	// Use AddHoleToWallWithThickness method to create wall with custom thickness
 	Room.RoomUnit->AddHoleToWallWithThickness(this, WallSide, DoorConfig, WallThickness, SmallerWallSize);
+	SubmitQueuedRoomMeshes();
+	RebuildDirtyChunks();
+	if (GetWorldTimerManager().IsTimerActive(RoomLodTimer))
+	{
+		RegisterRoomLod(Room);
+	}
 	
 	FString ConnectionTypeStr = (ConnectionType == EConnectionType::Doorway) ? TEXT("doorway") : TEXT("opening");
 	DebugLog(FString::Printf(TEXT("Created thick %s in room %d on %s wall (%.1fm wide x %.1fm high, %.1fm thick)"), 
@@ -472,20 +726,229 @@ void ABackRoomGenerator::RegenerateSpecificWall(FRoomData& Room, EWallSide WallS
 
 	// Use the new AddHoleToWall method instead of full room regeneration
 	Room.RoomUnit->AddHoleToWall(this, WallSide, DoorConfig);
+	SubmitQueuedRoomMeshes();
+	RebuildDirtyChunks();
+	
+	// The re-cut wall is a new actor - refresh the room's LOD registration
+	if (GetWorldTimerManager().IsTimerActive(RoomLodTimer))
+	{
+		RegisterRoomLod(Room);
+	}
 }
 
-void ABackRoomGenerator::CreateIdentifierSpheres(UStandardRoom* Room)
+void ABackRoomGenerator::ApplyRoomBuildMode(UStandardRoom* RoomUnit) const
 {
-	if (!Room) return;
+	RoomUnit->bMergeRoomMesh = Config.bMergeRoomMeshes;
+	RoomUnit->ChunkBuilder = Config.bUseChunkMeshes ? ChunkBuilder.Get() : nullptr;
+	RoomUnit->InstancedWalls = Config.bInstanceSolidWalls ? InstancedWallRenderer.Get() : nullptr;
+	RoomUnit->MeshBatch = Config.bParallelMeshBuild ? MeshBatchBuilder.Get() : nullptr;
+	RoomUnit->bSimpleWallCollision = Config.bSimpleWallCollision;
+	RoomUnit->bAsyncCollisionCooking = Config.bAsyncCollisionCooking;
+	RoomUnit->CookTracker = CookTracker.Get();
+	RoomUnit->WallPool = Config.bPoolWallActors ? WallActorPool.Get() : nullptr;
+	RoomUnit->DebugMarkers = DebugMarkerOverlay.Get();
+	RoomUnit->bBatchRoomNumbers = Config.bBatchedRoomNumbers;
+	RoomUnit->bDeferWallBuild = Config.bTwoPhaseRoomBuild;
+}
+
+void ABackRoomGenerator::SubmitQueuedRoomMeshes()
+{
+	if (!Config.bParallelMeshBuild)
+	{
+		return;
+	}
 	
-	// Load sphere mesh
-	UStaticMesh* SphereMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere"));
-	if (!SphereMesh)
+	// Walls queued since the last submit are built on worker threads, then spawned/uploaded here
+	int32 Submitted = MeshBatchBuilder->BuildAndSubmit();
+	if (Submitted > 0)
+	{
+		int32 NumBatches, NumWalls;
+		double BuildSeconds, SubmitSeconds;
+		MeshBatchBuilder->GetBatchStats(NumBatches, NumWalls, BuildSeconds, SubmitSeconds);
+		DebugLog(FString::Printf(TEXT("🧵 Parallel mesh build: %d walls in %d batches (build %.1f ms, game thread submit %.1f ms)"), 
+			NumWalls, NumBatches, BuildSeconds * 1000.0, SubmitSeconds * 1000.0));
+	}
+}
+
+void ABackRoomGenerator::WaitForRoomCollision()
+{
+	// Every room waits for the components its surfaces were submitted to
+	for (UStandardRoom* RoomUnit : RoomUnits)
+	{
+		CookTracker->AddRoom(RoomUnit);
+	}
+	
+	CookWaitStartSeconds = FPlatformTime::Seconds();
+	PollRoomReady();
+	if (CookTracker->GetNumPendingRooms() > 0)
+	{
+		GetWorldTimerManager().SetTimer(RoomReadyTimer, this, &ABackRoomGenerator::PollRoomReady, 0.05f, true);
+	}
+}
+
+void ABackRoomGenerator::PollRoomReady()
+{
+	TArray<const UObject*> ReadyRooms;
+	CookTracker->PollReadyRooms(ReadyRooms, Config.CollisionCookTimeout);
+	
+	for (const UObject* ReadyRoom : ReadyRooms)
+	{
+		const int32 RoomIndex = GeneratedRooms.IndexOfByPredicate([ReadyRoom](const FRoomData& Room)
+		{
+			return Room.RoomUnit == ReadyRoom;
+		});
+		if (RoomIndex != INDEX_NONE)
+		{
+			ReadyRoomIndices.Add(RoomIndex);
+			OnRoomReady.Broadcast(RoomIndex);
+		}
+	}
+	
+	if (CookTracker->GetNumPendingRooms() > 0)
+	{
+		return;
+	}
+	
+	GetWorldTimerManager().ClearTimer(RoomReadyTimer);
+	if (Config.bAsyncCollisionCooking)
+	{
+		DebugLog(FString::Printf(TEXT("🧱 All %d rooms walkable %.1f ms after generation (async collision cooking)"), 
+			ReadyRoomIndices.Num(), (FPlatformTime::Seconds() - CookWaitStartSeconds) * 1000.0));
+		if (Config.bMeasureCollisionCost)
+		{
+			MeasureCollisionSweeps();
+		}
+	}
+}
+
+void ABackRoomGenerator::RegisterRoomLod(const FRoomData& Room)
+{
+	if (!Room.RoomUnit)
 	{
-		DebugLog(TEXT("Failed to load sphere mesh for identifiers"));
 		return;
 	}
 	
+	TArray<AActor*> DetailActors;
+	Room.RoomUnit->GetDetailActors(DetailActors);
+	TArray<int32> ConnectedRooms;
+	for (const FRoomConnection& Connection : Room.Connections)
+	{
+		if (Connection.bIsUsed && Connection.ConnectedRoomIndex >= 0)
+		{
+			ConnectedRooms.AddUnique(Connection.ConnectedRoomIndex);
+		}
+	}
+	
+	RoomLodManager->RegisterRoom(Room.RoomIndex, Room.GetBoundingBox(), ConnectedRooms,
+		Room.RoomUnit->CreateLodProxyActor(GetWorld()), DetailActors);
+}
+
+void ABackRoomGenerator::UpdateRoomLod()
+{
+	// The camera decides what is near; fall back to the pawn before a camera exists
+	UWorld* World = GetWorld();
+	APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+	if (!PC)
+	{
+		return;
+	}
+	FVector ViewerLocation;
+	if (PC->PlayerCameraManager)
+	{
+		ViewerLocation = PC->PlayerCameraManager->GetCameraLocation();
+	}
+	else if (APawn* Pawn = PC->GetPawn())
+	{
+		ViewerLocation = Pawn->GetActorLocation();
+	}
+	else
+	{
+		return;
+	}
+	
+	const int32 Swaps = RoomLodManager->UpdateLod(ViewerLocation, Config.RoomLodMetric,
+		MetersToUnrealUnits(Config.RoomLodDistance), Config.RoomLodHops);
+	if (Swaps > 0 && Config.bVerboseLogging)
+	{
+		int32 NumRooms, NumProxies, DrawnTriangles, FullTriangles;
+		RoomLodManager->GetLodStats(NumRooms, NumProxies, DrawnTriangles, FullTriangles);
+		DebugLog(FString::Printf(TEXT("🔭 Room LOD: %d/%d rooms as proxies (%d swapped), %d of %d room triangles drawn"), 
+			NumProxies, NumRooms, Swaps, DrawnTriangles, FullTriangles));
+	}
+}
+
+bool ABackRoomGenerator::IsRoomReady(int32 RoomIndex) const
+{
+	return ReadyRoomIndices.Contains(RoomIndex);
+}
+
+void ABackRoomGenerator::SetDebugMarkersVisible(bool bVisible)
+{
+	Config.bShowDebugMarkers = bVisible;
+	DebugMarkerOverlay->SetVisible(bVisible);
+}
+
+void ABackRoomGenerator::RebuildDirtyChunks()
+{
+	if (!Config.bUseChunkMeshes)
+	{
+		return;
+	}
+	
+	// Only chunks containing a changed room are re-concatenated
+	int32 Rebuilt = ChunkBuilder->RebuildDirtyChunks();
+	if (Rebuilt > 0)
+	{
+		int32 NumChunks, NumSections, TotalRebuilds;
+		ChunkBuilder->GetChunkStats(NumChunks, NumSections, TotalRebuilds);
+		DebugLog(FString::Printf(TEXT("🧱 Chunk meshes: %d chunks, %d sections (%d rebuilt now, %d total)"), 
+			NumChunks, NumSections, Rebuilt, TotalRebuilds));
+	}
+}
+
+void ABackRoomGenerator::MeasureCollisionSweeps() const
+{
+	UWorld* World = GetWorld();
+	if (!World || GeneratedRooms.Num() == 0)
+	{
+		return;
+	}
+	
+	// Default ACharacter capsule, swept on the Pawn channel like CharacterMovement does
+	const FCollisionShape Capsule = FCollisionShape::MakeCapsule(34.0f, 88.0f);
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(BackroomCollisionSweep), false);
+	const FVector Directions[] = { FVector(1, 0, 0), FVector(-1, 0, 0), FVector(0, 1, 0), FVector(0, -1, 0) };
+	
+	int32 Sweeps = 0;
+	int32 Hits = 0;
+	const double SweepStart = FPlatformTime::Seconds();
+	for (const FRoomData& Room : GeneratedRooms)
+	{
+		// From the room center at walking height out past its walls in each direction
+		const FVector RoomSizeCm(MetersToUnrealUnits(Room.Width), MetersToUnrealUnits(Room.Length), 0.0f);
+		const FVector Start = Room.Position + FVector(RoomSizeCm.X * 0.5f, RoomSizeCm.Y * 0.5f, 100.0f);
+		for (const FVector& Direction : Directions)
+		{
+			FHitResult Hit;
+			const FVector End = Start + Direction * RoomSizeCm.GetMax();
+			if (World->SweepSingleByChannel(Hit, Start, End, FQuat::Identity, ECC_Pawn, Capsule, QueryParams))
+			{
+				Hits++;
+			}
+			Sweeps++;
+		}
+	}
+	const double SweepSeconds = FPlatformTime::Seconds() - SweepStart;
+	
+	DebugLog(FString::Printf(TEXT("🧱 Collision sweeps (%s): %d capsule sweeps, %d hits, %.2f us per sweep"), 
+		Config.bSimpleWallCollision ? TEXT("simple boxes") : TEXT("complex trimesh"), 
+		Sweeps, Hits, (SweepSeconds * 1000000.0) / Sweeps));
+}
+
+void ABackRoomGenerator::CreateIdentifierSpheres(UStandardRoom* Room)
+{
+	if (!Room) return;
+	
 	// Room dimensions in cm
 	float RoomWidthCm = MetersToUnrealUnits(Room->Width);
 	float RoomLengthCm = MetersToUnrealUnits(Room->Length);
@@ -532,34 +995,12 @@ void ABackRoomGenerator::CreateIdentifierSpheres(UStandardRoom* Room)
 		}
 	};
 	
-	// Create spheres
+	// Spheres are instances of the shared marker overlay
 	for (int32 i = 0; i < SphereConfigs.Num(); i++)
 	{
 		const SphereConfig& SphereConf = SphereConfigs[i];
 		
-		// Create sphere component
-		UStaticMeshComponent* SphereComponent = NewObject<UStaticMeshComponent>(this, 
-			*FString::Printf(TEXT("IdentifierSphere_%d"), i));
-		
-		SphereComponent->SetStaticMesh(SphereMesh);
-		SphereComponent->SetupAttachment(GetRootComponent());
-		SphereComponent->RegisterComponent();
-		SphereComponent->SetWorldLocation(SphereConf.Position);
-		SphereComponent->SetWorldScale3D(FVector(0.5f)); // 50cm diameter spheres
-		
-		// Create dynamic material with primary color
-		UMaterialInterface* BaseMaterial = LoadObject<UMaterialInterface>(nullptr, 
-			TEXT("/Engine/BasicShapes/BasicShapeMaterial"));
-		
-		if (BaseMaterial)
-		{
-			UMaterialInstanceDynamic* DynamicMaterial = UMaterialInstanceDynamic::Create(BaseMaterial, this);
-			if (DynamicMaterial)
-			{
-				DynamicMaterial->SetVectorParameterValue(TEXT("Color"), SphereConf.Color);
-				SphereComponent->SetMaterial(0, DynamicMaterial);
-			}
-		}
+		DebugMarkerOverlay->AddMarker(SphereConf.Position, 50.0f, SphereConf.Color); // 50cm diameter spheres
 		
 		DebugLog(FString::Printf(TEXT("Created identifier sphere for %s at %s"), 
 			*SphereConf.Description, *SphereConf.Position.ToString()));
@@ -11,10 +11,31 @@
 #include "Services/RoomConnectionManager.h"
 #include "Services/IGenerationOrchestrator.h"
 #include "Services/GenerationOrchestrator.h"
+#include "Services/IChunkMeshBuilder.h"
+#include "Services/ChunkMeshBuilder.h"
+#include "Services/IInstancedWallRenderer.h"
+#include "Services/InstancedWallRenderer.h"
+#include "Services/IRoomMeshBatchBuilder.h"
+#include "Services/RoomMeshBatchBuilder.h"
+#include "Services/ICollisionCookTracker.h"
+#include "Services/CollisionCookTracker.h"
+#include "Services/IRoomLodManager.h"
+#include "Services/RoomLodManager.h"
+#include "Services/IWallActorPool.h"
+#include "Services/WallActorPool.h"
+#include "Services/IWallGraphResolver.h"
+#include "Services/WallGraphResolver.h"
+#include "Services/IDebugMarkerOverlay.h"
+#include "Services/DebugMarkerOverlay.h"
+#include "Services/ILayoutCache.h"
+#include "Services/LayoutCache.h"
 #include "Main.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogBackRoomGenerator, Log, All);
 
+// Fired once a generated room's collision is in place and it can be walked on (index into the generated rooms)
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBackroomRoomReady, int32, RoomIndex);
+
 UCLASS()
 class ABackRoomGenerator : public AActor
 {
@@ -25,6 +46,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// Configuration - Centralized settings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation")
@@ -48,6 +70,17 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Generation")
 	void GenerateBackroomsInTestMode();
 
+	// Room readiness - streaming / despawn logic waits for this before relying on a room's collision
+	UPROPERTY(BlueprintAssignable, Category = "Generation")
+	FOnBackroomRoomReady OnRoomReady;
+
+	UFUNCTION(BlueprintCallable, Category = "Generation")
+	bool IsRoomReady(int32 RoomIndex) const;
+
+	// Show or hide every debug marker of the current layout (markers are built on first show)
+	UFUNCTION(BlueprintCallable, Category = "Debug")
+	void SetDebugMarkersVisible(bool bVisible);
+
 private:
 	UPROPERTY()
 	TArray<UStandardRoom*> RoomUnits;
@@ -59,6 +92,23 @@ private:
 	TUniquePtr<ICollisionDetectionService> CollisionService;
 	TUniquePtr<IRoomConnectionManager> ConnectionManager;
 	TUniquePtr<IGenerationOrchestrator> GenerationOrchestrator;
+	TUniquePtr<IChunkMeshBuilder> ChunkBuilder;
+	TUniquePtr<IInstancedWallRenderer> InstancedWallRenderer;
+	TUniquePtr<IRoomMeshBatchBuilder> MeshBatchBuilder;
+	TUniquePtr<ICollisionCookTracker> CookTracker;
+	TUniquePtr<IWallActorPool> WallActorPool;
+	TUniquePtr<IWallGraphResolver> WallGraphResolver;
+	TUniquePtr<IDebugMarkerOverlay> DebugMarkerOverlay;
+	TUniquePtr<ILayoutCache> LayoutCache;
+
+	// Rooms whose collision cooks have finished, and the poll that finds them
+	TSet<int32> ReadyRoomIndices;
+	FTimerHandle RoomReadyTimer;
+	double CookWaitStartSeconds = 0.0;
+
+	// Room proxy LOD, re-evaluated around the viewer on a timer
+	TUniquePtr<IRoomLodManager> RoomLodManager;
+	FTimerHandle RoomLodTimer;
 
 	void DebugLog(const FString& Message) const;
 	void CreateIdentifierSpheres(UStandardRoom* Room);
@@ -75,7 +125,23 @@ private:
 	// Procedural room generation functions
 	void GenerateProceduralRooms();
 	FRoomData CreateInitialRoom(const FVector& CharacterLocation);
+	// Where the initial room goes so the character stands on its floor
+	FVector GetInitialRoomPosition(const FVector& CharacterLocation) const;
+	// Room unit, number and character placement of the initial room (connections are left to the caller)
+	void BuildInitialRoom(FRoomData& InitialRoom);
 	FRoomData GenerateRandomRoom(ERoomCategory Category, int32 RoomIndex);
 	FRoomData GenerateRandomRoom(ERoomCategory Category, int32 RoomIndex, const FRoomData& SourceRoom, int32 ConnectionIndex);
 	void RegenerateSpecificWall(FRoomData& Room, EWallSide WallSide, const FDoorConfig& DoorConfig);
+	
+	// Room build mode (individual actors / merged room mesh / spatial chunks) from Config
+	void ApplyRoomBuildMode(UStandardRoom* RoomUnit) const;
+	void RebuildDirtyChunks();
+	void SubmitQueuedRoomMeshes();
+	void WaitForRoomCollision();
+	void PollRoomReady();
+	void RegisterRoomLod(const FRoomData& Room);
+	void UpdateRoomLod();
+	
+	// Capsule sweeps through every room (CharacterMovement-sized) to compare collision modes
+	void MeasureCollisionSweeps() const;
 };
\ No newline at end of file
@@ -0,0 +1,451 @@
+#include "BillboardLabelSubsystem.h"
+#include "BillboardTextActor.h"
+#include "../WallUnit/WallMaterialCache.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Containers/StaticArray.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+namespace
+{
+	// Seven-segment glyphs in glyph units (1 = digit height, digits are 0.6 wide)
+	constexpr float GlyphWidth = 0.6f;
+	constexpr float GlyphStroke = 0.12f;
+	constexpr float GlyphSpacing = 0.2f;
+	constexpr float BarDepthCm = 4.0f;
+
+	// Lit segments per digit: bit 0..6 = top, upper right, lower right, bottom, lower left, upper left, middle
+	constexpr uint8 DigitSegments[10] = { 0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F };
+
+	// Glyph atlas: bar rectangles of every digit, built once
+	const TArray<FBox2D>& GetDigitGlyph(int32 Digit)
+	{
+		static const TStaticArray<TArray<FBox2D>, 10> Glyphs = [] {
+			const float W = GlyphWidth;
+			const float T = GlyphStroke;
+			const FBox2D Segments[7] = {
+				FBox2D(FVector2D(0.0f, 1.0f - T), FVector2D(W, 1.0f)),                // Top
+				FBox2D(FVector2D(W - T, 0.5f), FVector2D(W, 1.0f)),                   // Upper right
+				FBox2D(FVector2D(W - T, 0.0f), FVector2D(W, 0.5f)),                   // Lower right
+				FBox2D(FVector2D(0.0f, 0.0f), FVector2D(W, T)),                       // Bottom
+				FBox2D(FVector2D(0.0f, 0.0f), FVector2D(T, 0.5f)),                    // Lower left
+				FBox2D(FVector2D(0.0f, 0.5f), FVector2D(T, 1.0f)),                    // Upper left
+				FBox2D(FVector2D(0.0f, 0.5f - T * 0.5f), FVector2D(W, 0.5f + T * 0.5f)) // Middle
+			};
+			TStaticArray<TArray<FBox2D>, 10> Result;
+			for (int32 Index = 0; Index < 10; Index++)
+			{
+				for (int32 Segment = 0; Segment < 7; Segment++)
+				{
+					if (DigitSegments[Index] & (1 << Segment))
+					{
+						Result[Index].Add(Segments[Segment]);
+					}
+				}
+			}
+			return Result;
+		}();
+		return Glyphs[FMath::Clamp(Digit, 0, 9)];
+	}
+}
+
+void UBillboardLabelSubsystem::RegisterLabel(ABillboardTextActor* Label)
+{
+	if (!IsValid(Label) || SlotByLabel.Contains(Label))
+	{
+		return;
+	}
+
+	const int32 Slot = AddEntry(Label->GetActorLocation());
+	Entries[Slot].Label = Label;
+	SlotByLabel.Add(Label, Slot);
+
+	// Hidden until an update finds it near the viewer
+	Label->SetActorHiddenInGame(true);
+}
+
+void UBillboardLabelSubsystem::UnregisterLabel(ABillboardTextActor* Label)
+{
+	int32 Slot;
+	if (SlotByLabel.RemoveAndCopyValue(Label, Slot))
+	{
+		RemoveEntry(Slot);
+	}
+}
+
+void UBillboardLabelSubsystem::AddNumberLabel(const FVector& Location, int32 Number, float HeightCm)
+{
+	const FString Digits = FString::FromInt(FMath::Abs(Number));
+	const float DigitWidth = GlyphWidth * HeightCm;
+	const float Advance = (GlyphWidth + GlyphSpacing) * HeightCm;
+	const float TotalWidth = Digits.Len() * DigitWidth + (Digits.Len() - 1) * GlyphSpacing * HeightCm;
+
+	UInstancedStaticMeshComponent* Instances = GetNumberInstances();
+	if (!Instances)
+	{
+		return;
+	}
+
+	// Lay the digits out centered on the label, bars in cm from the label center
+	const int32 FirstBar = NumberBars.Num();
+	for (int32 Index = 0; Index < Digits.Len(); Index++)
+	{
+		const FVector2D DigitOrigin(-TotalWidth * 0.5f + Index * Advance, -HeightCm * 0.5f);
+		for (const FBox2D& Rect : GetDigitGlyph(Digits[Index] - TEXT('0')))
+		{
+			FNumberBar& Bar = NumberBars.AddDefaulted_GetRef();
+			Bar.Center = DigitOrigin + Rect.GetCenter() * HeightCm;
+			Bar.Size = Rect.GetSize() * HeightCm;
+		}
+	}
+
+	const int32 Slot = AddEntry(Location);
+	Entries[Slot].FirstBar = FirstBar;
+	Entries[Slot].NumBars = NumberBars.Num() - FirstBar;
+
+	// Same range of instances as bars; they start collapsed until an update finds the label near the viewer
+	BarTransforms.Reset();
+	BarTransforms.Init(FTransform(FQuat::Identity, Location, FVector::ZeroVector), NumberBars.Num() - FirstBar);
+	Instances->AddInstances(BarTransforms, false, true);
+	if (!ensureMsgf(Instances->GetInstanceCount() == NumberBars.Num(),
+		TEXT("BillboardLabelSubsystem: %d number instances for %d bars"), Instances->GetInstanceCount(), NumberBars.Num()))
+	{
+		RebuildNumberInstances(*Instances);
+	}
+}
+
+void UBillboardLabelSubsystem::ResetNumberLabels()
+{
+	for (int32 Slot = 0; Slot < Entries.Num(); Slot++)
+	{
+		if (Entries[Slot].FirstBar != INDEX_NONE)
+		{
+			RemoveEntry(Slot);
+		}
+	}
+	NumberBars.Empty();
+	if (AActor* Host = NumberHostActor.Get())
+	{
+		Host->Destroy();
+	}
+	NumberHostActor.Reset();
+	NumberInstances.Reset();
+	bNumberInstancesDirty = false;
+}
+
+void UBillboardLabelSubsystem::SetVisibilityRadius(float RadiusCm)
+{
+	if (RadiusCm == VisibilityRadius)
+	{
+		return;
+	}
+	VisibilityRadius = RadiusCm;
+
+	// The grid cell size follows the radius
+	LabelGrid.Reset();
+	for (int32 Slot = 0; Slot < Entries.Num(); Slot++)
+	{
+		FLabelEntry& Entry = Entries[Slot];
+		if (Entry.IsInUse())
+		{
+			Entry.Cell = GetCell(Entry.Location);
+			LabelGrid.FindOrAdd(Entry.Cell).Add(Slot);
+		}
+	}
+}
+
+void UBillboardLabelSubsystem::GetLabelStats(int32& OutLabels, int32& OutVisible, int32& OutNumberInstances) const
+{
+	OutLabels = NumLabels;
+	OutVisible = VisibleSlots.Num();
+	OutNumberInstances = NumberBars.Num();
+}
+
+void UBillboardLabelSubsystem::Deinitialize()
+{
+	// The world is going away with the host actor, only let go of it
+	NumberBars.Empty();
+	NumberHostActor.Reset();
+	NumberInstances.Reset();
+	Entries.Empty();
+	FreeSlots.Empty();
+	SlotByLabel.Empty();
+	LabelGrid.Empty();
+	VisibleSlots.Empty();
+	NextVisibleSlots.Empty();
+	NumLabels = 0;
+
+	Super::Deinitialize();
+}
+
+void UBillboardLabelSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FVector ViewLocation;
+	if (NumLabels == 0 || !GetViewLocation(ViewLocation))
+	{
+		return;
+	}
+
+	// Show and turn every label within the radius
+	UpdateCounter++;
+	NextVisibleSlots.Reset();
+	const float RadiusSquared = FMath::Square(VisibilityRadius);
+	auto VisitSlot = [&](int32 Slot)
+	{
+		FLabelEntry& Entry = Entries[Slot];
+		if (!Entry.IsInUse() || (VisibilityRadius > 0.0f && FVector::DistSquared(Entry.Location, ViewLocation) > RadiusSquared))
+		{
+			return;
+		}
+		const bool bWasVisible = Entry.bVisible;
+		SetLabelVisible(Entry, true);
+		FaceViewer(Entry, ViewLocation, !bWasVisible);
+		Entry.SeenUpdate = UpdateCounter;
+		NextVisibleSlots.Add(Slot);
+	};
+
+	if (VisibilityRadius > 0.0f)
+	{
+		const FIntPoint ViewCell = GetCell(ViewLocation);
+		for (int32 OffsetX = -1; OffsetX <= 1; OffsetX++)
+		{
+			for (int32 OffsetY = -1; OffsetY <= 1; OffsetY++)
+			{
+				if (const TArray<int32>* CellSlots = LabelGrid.Find(ViewCell + FIntPoint(OffsetX, OffsetY)))
+				{
+					for (int32 Slot : *CellSlots)
+					{
+						VisitSlot(Slot);
+					}
+				}
+			}
+		}
+	}
+	else
+	{
+		for (int32 Slot = 0; Slot < Entries.Num(); Slot++)
+		{
+			VisitSlot(Slot);
+		}
+	}
+
+	// Hide labels that were shown last update but are out of range now
+	for (int32 Slot : VisibleSlots)
+	{
+		FLabelEntry& Entry = Entries[Slot];
+		if (Entry.SeenUpdate != UpdateCounter)
+		{
+			SetLabelVisible(Entry, false);
+		}
+	}
+	Swap(VisibleSlots, NextVisibleSlots);
+
+	// All number bar changes of this update reach the renderer together
+	if (bNumberInstancesDirty)
+	{
+		bNumberInstancesDirty = false;
+		if (UInstancedStaticMeshComponent* Instances = NumberInstances.Get())
+		{
+			Instances->MarkRenderStateDirty();
+		}
+	}
+}
+
+TStatId UBillboardLabelSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBillboardLabelSubsystem, STATGROUP_Tickables);
+}
+
+int32 UBillboardLabelSubsystem::AddEntry(const FVector& Location)
+{
+	const int32 Slot = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+	FLabelEntry& Entry = Entries[Slot];
+	Entry = FLabelEntry();
+	Entry.Location = Location;
+	Entry.Cell = GetCell(Location);
+	LabelGrid.FindOrAdd(Entry.Cell).Add(Slot);
+	NumLabels++;
+	return Slot;
+}
+
+void UBillboardLabelSubsystem::RemoveEntry(int32 Slot)
+{
+	FLabelEntry& Entry = Entries[Slot];
+	if (TArray<int32>* CellSlots = LabelGrid.Find(Entry.Cell))
+	{
+		CellSlots->RemoveSingleSwap(Slot, EAllowShrinking::No);
+	}
+	VisibleSlots.RemoveSingleSwap(Slot, EAllowShrinking::No);
+	Entry = FLabelEntry();
+	FreeSlots.Add(Slot);
+	NumLabels--;
+}
+
+FIntPoint UBillboardLabelSubsystem::GetCell(const FVector& Location) const
+{
+	if (VisibilityRadius <= 0.0f)
+	{
+		return FIntPoint::ZeroValue;
+	}
+	return FIntPoint(FMath::FloorToInt(Location.X / VisibilityRadius), FMath::FloorToInt(Location.Y / VisibilityRadius));
+}
+
+void UBillboardLabelSubsystem::FaceViewer(FLabelEntry& Entry, const FVector& ViewLocation, bool bForce)
+{
+	if (ABillboardTextActor* Label = Entry.Label.Get())
+	{
+		Label->FaceLocation(ViewLocation);
+		return;
+	}
+	if (Entry.FirstBar == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Same upright turn as ABillboardTextActor::FaceLocation, skipped while the viewer barely moves
+	const float Yaw = (ViewLocation - Entry.Location).Rotation().Yaw;
+	if (!bForce && FMath::Abs(FRotator::NormalizeAxis(Yaw - Entry.FacingYaw)) < 0.5f)
+	{
+		return;
+	}
+	Entry.FacingYaw = Yaw;
+	WriteNumberBars(Entry, true);
+}
+
+void UBillboardLabelSubsystem::WriteNumberBars(FLabelEntry& Entry, bool bVisible)
+{
+	UInstancedStaticMeshComponent* Instances = NumberInstances.Get();
+	if (!Instances || Entry.NumBars == 0)
+	{
+		return;
+	}
+
+	BarTransforms.Reset();
+	if (bVisible)
+	{
+		// Bars face the viewer: label X runs to the viewer's right, the unit cube's X is the bar depth
+		const FQuat Facing(FRotator(0.0f, Entry.FacingYaw, 0.0f));
+		const FVector Right = Facing.RotateVector(FVector(0.0f, -1.0f, 0.0f));
+		for (int32 Index = 0; Index < Entry.NumBars; Index++)
+		{
+			const FNumberBar& Bar = NumberBars[Entry.FirstBar + Index];
+			const FVector BarCenter = Entry.Location + Right * Bar.Center.X + FVector(0.0f, 0.0f, Bar.Center.Y);
+			BarTransforms.Add(FTransform(Facing, BarCenter, FVector(BarDepthCm, Bar.Size.X, Bar.Size.Y) / 100.0f));
+		}
+	}
+	else
+	{
+		// Collapsed instances draw nothing
+		BarTransforms.Init(FTransform(FQuat::Identity, Entry.Location, FVector::ZeroVector), Entry.NumBars);
+	}
+
+	Instances->BatchUpdateInstancesTransforms(Entry.FirstBar, BarTransforms, false, false, true);
+	bNumberInstancesDirty = true;
+}
+
+UInstancedStaticMeshComponent* UBillboardLabelSubsystem::GetNumberInstances()
+{
+	if (UInstancedStaticMeshComponent* Instances = NumberInstances.Get())
+	{
+		return Instances;
+	}
+
+	UWorld* World = GetWorld();
+	UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube"));
+	if (!World || !CubeMesh)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BillboardLabelSubsystem: cannot create number label instances"));
+		return nullptr;
+	}
+
+	// Host at the world origin, so instance transforms stay in world space
+	AActor* Host = World->SpawnActor<AActor>();
+	USceneComponent* Root = NewObject<USceneComponent>(Host);
+	Host->SetRootComponent(Root);
+	Root->RegisterComponent();
+
+	UInstancedStaticMeshComponent* Instances = NewObject<UInstancedStaticMeshComponent>(Host);
+	Instances->SetStaticMesh(CubeMesh);
+	Instances->SetupAttachment(Root);
+	Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Instances->SetCastShadow(false);
+	Instances->RegisterComponent();
+	Instances->SetMaterial(0, UWallMaterialCache::GetColorMaterial(FLinearColor::White));
+
+	NumberHostActor = Host;
+	NumberInstances = Instances;
+
+	// The previous host was destroyed behind our back (e.g. a level reload) - its labels get their instances back
+	if (NumberBars.Num() > 0)
+	{
+		RebuildNumberInstances(*Instances);
+	}
+	return Instances;
+}
+
+void UBillboardLabelSubsystem::RebuildNumberInstances(UInstancedStaticMeshComponent& Instances)
+{
+	// One collapsed instance per bar, in bar order, so every label's range lines up again
+	Instances.ClearInstances();
+	BarTransforms.Reset();
+	BarTransforms.Init(FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), NumberBars.Num());
+	for (FLabelEntry& Entry : Entries)
+	{
+		if (Entry.FirstBar == INDEX_NONE)
+		{
+			continue;
+		}
+		for (int32 Index = 0; Index < Entry.NumBars; Index++)
+		{
+			BarTransforms[Entry.FirstBar + Index].SetLocation(Entry.Location);
+		}
+		// Shown and turned again by the next update if still near the viewer
+		Entry.bVisible = false;
+	}
+	Instances.AddInstances(BarTransforms, false, true);
+	bNumberInstancesDirty = true;
+}
+
+void UBillboardLabelSubsystem::SetLabelVisible(FLabelEntry& Entry, bool bVisible)
+{
+	if (Entry.bVisible == bVisible)
+	{
+		return;
+	}
+	Entry.bVisible = bVisible;
+	if (ABillboardTextActor* Label = Entry.Label.Get())
+	{
+		Label->SetActorHiddenInGame(!bVisible);
+	}
+	else if (!bVisible && Entry.FirstBar != INDEX_NONE)
+	{
+		WriteNumberBars(Entry, false);
+	}
+}
+
+bool UBillboardLabelSubsystem::GetViewLocation(FVector& OutLocation) const
+{
+	// The camera decides what is near; fall back to the pawn before a camera exists
+	const UWorld* World = GetWorld();
+	APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+	if (!PC)
+	{
+		return false;
+	}
+	if (PC->PlayerCameraManager)
+	{
+		OutLocation = PC->PlayerCameraManager->GetCameraLocation();
+		return true;
+	}
+	if (APawn* Pawn = PC->GetPawn())
+	{
+		OutLocation = Pawn->GetActorLocation();
+		return true;
+	}
+	return false;
+}
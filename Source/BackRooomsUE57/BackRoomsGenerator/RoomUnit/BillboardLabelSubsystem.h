@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BillboardLabelSubsystem.generated.h"
+
+class ABillboardTextActor;
+class UInstancedStaticMeshComponent;
+
+// Turns every billboard label toward the viewer in one pass per frame
+// Labels are bucketed in a grid of radius-sized cells, so a frame only looks at the 3x3 cells around the viewer:
+// labels inside the visibility radius are shown and turned, labels that left it are hidden, the rest are never touched
+// Labels are expected to stay where they were registered (room numbers do)
+// Number labels need no actor at all: their digits are seven-segment bars drawn as instances of one shared component
+UCLASS()
+class UBillboardLabelSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Labels register themselves on BeginPlay and leave on EndPlay
+	void RegisterLabel(ABillboardTextActor* Label);
+	void UnregisterLabel(ABillboardTextActor* Label);
+
+	// Actor-free number label centered on Location, digits HeightCm tall - every digit bar is an instance of one component
+	void AddNumberLabel(const FVector& Location, int32 Number, float HeightCm);
+	// Drop all number labels (new layout)
+	void ResetNumberLabels();
+
+	// Labels farther than this from the viewer are hidden (cm, <= 0 = every label is shown and turned)
+	void SetVisibilityRadius(float RadiusCm);
+
+	// Registered labels, labels shown in the last update and digit bar instances of the number labels
+	void GetLabelStats(int32& OutLabels, int32& OutVisible, int32& OutNumberInstances) const;
+
+	// UTickableWorldSubsystem
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	struct FLabelEntry
+	{
+		TWeakObjectPtr<ABillboardTextActor> Label;
+		FVector Location = FVector::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		bool bVisible = false;
+		uint32 SeenUpdate = 0;
+
+		// Number labels: bars [FirstBar, FirstBar + NumBars) of NumberBars, drawn as the same instance range
+		int32 FirstBar = INDEX_NONE;
+		int32 NumBars = 0;
+		float FacingYaw = 0.0f;
+
+		bool IsInUse() const { return Label.IsValid() || FirstBar != INDEX_NONE; }
+	};
+
+	// One digit bar in label space (cm from the label center: X = right as seen by the viewer, Y = up)
+	struct FNumberBar
+	{
+		FVector2D Center = FVector2D::ZeroVector;
+		FVector2D Size = FVector2D::ZeroVector;
+	};
+
+	// Slots are reused after a label leaves, so grid cells and the visible list can hold plain indices
+	TArray<FLabelEntry> Entries;
+	TArray<int32> FreeSlots;
+	TMap<ABillboardTextActor*, int32> SlotByLabel;
+	TMap<FIntPoint, TArray<int32>> LabelGrid;
+	int32 NumLabels = 0;
+
+	// Number labels: bars of every label and the instanced component drawing them (on a host actor at the origin)
+	TArray<FNumberBar> NumberBars;
+	TWeakObjectPtr<AActor> NumberHostActor;
+	TWeakObjectPtr<UInstancedStaticMeshComponent> NumberInstances;
+	TArray<FTransform> BarTransforms;
+	bool bNumberInstancesDirty = false;
+
+	TArray<int32> VisibleSlots;
+	TArray<int32> NextVisibleSlots;
+	uint32 UpdateCounter = 0;
+
+	float VisibilityRadius = 3000.0f; // 30m
+
+	int32 AddEntry(const FVector& Location);
+	void RemoveEntry(int32 Slot);
+	FIntPoint GetCell(const FVector& Location) const;
+	void FaceViewer(FLabelEntry& Entry, const FVector& ViewLocation, bool bForce);
+	void WriteNumberBars(FLabelEntry& Entry, bool bVisible);
+	UInstancedStaticMeshComponent* GetNumberInstances();
+	void RebuildNumberInstances(UInstancedStaticMeshComponent& Instances);
+	void SetLabelVisible(FLabelEntry& Entry, bool bVisible);
+	bool GetViewLocation(FVector& OutLocation) const;
+};
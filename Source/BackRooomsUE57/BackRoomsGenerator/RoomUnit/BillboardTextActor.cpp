@@ -1,11 +1,10 @@
 #include "BillboardTextActor.h"
-#include "GameFramework/Pawn.h"
+#include "BillboardLabelSubsystem.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
 
 ABillboardTextActor::ABillboardTextActor()
 {
-	PrimaryActorTick.bCanEverTick = false; // We use timer instead of tick
+	PrimaryActorTick.bCanEverTick = false; // UBillboardLabelSubsystem turns all labels in one pass
 
 	// Create text render component
 	TextRenderComponent = CreateDefaultSubobject<UTextRenderComponent>(TEXT("TextRenderComponent"));
@@ -24,28 +23,18 @@ void ABillboardTextActor::BeginPlay()
 {
 	Super::BeginPlay();
 	
-	// Start the timer to update rotation every UpdateInterval seconds
-	if (GetWorld())
+	// One shared manager shows, hides and turns every label instead of a timer per label
+	if (UBillboardLabelSubsystem* LabelSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UBillboardLabelSubsystem>() : nullptr)
 	{
-		GetWorld()->GetTimerManager().SetTimer(
-			UpdateTimer,
-			this,
-			&ABillboardTextActor::UpdateRotationTowardPlayer,
-			UpdateInterval,
-			true // Loop
-		);
-		
-		// Do initial rotation update
-		UpdateRotationTowardPlayer();
+		LabelSubsystem->RegisterLabel(this);
 	}
 }
 
 void ABillboardTextActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	// Clean up timer
-	if (GetWorld())
+	if (UBillboardLabelSubsystem* LabelSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UBillboardLabelSubsystem>() : nullptr)
 	{
-		GetWorld()->GetTimerManager().ClearTimer(UpdateTimer);
+		LabelSubsystem->UnregisterLabel(this);
 	}
 	
 	Super::EndPlay(EndPlayReason);
@@ -78,24 +67,20 @@ void ABillboardTextActor::SetTextColor(const FColor& NewColor)
 	}
 }
 
-void ABillboardTextActor::UpdateRotationTowardPlayer()
+void ABillboardTextActor::FaceLocation(const FVector& ViewLocation)
 {
-	UWorld* World = GetWorld();
-	if (!World) return;
-
-	APlayerController* PC = World->GetFirstPlayerController();
-	if (!PC || !PC->GetPawn()) return;
-
-	FVector PlayerLocation = PC->GetPawn()->GetActorLocation();
 	FVector TextLocation = GetActorLocation();
 	
-	// Calculate direction from text to player
-	FVector DirectionToPlayer = (PlayerLocation - TextLocation).GetSafeNormal();
+	// Calculate direction from text to viewer
+	FVector DirectionToViewer = (ViewLocation - TextLocation).GetSafeNormal();
 	
-	// Create rotation to face the player
-	FRotator LookAtRotation = DirectionToPlayer.Rotation();
+	// Create rotation to face the viewer
+	FRotator LookAtRotation = DirectionToViewer.Rotation();
 	LookAtRotation.Pitch = 0.0f; // Keep text upright
 	
-	// Apply the rotation
-	SetActorRotation(LookAtRotation);
+	// Apply the rotation (skip the transform update while the viewer barely moves)
+	if (!LookAtRotation.Equals(GetActorRotation(), 0.5f))
+	{
+		SetActorRotation(LookAtRotation);
+	}
 }
\ No newline at end of file
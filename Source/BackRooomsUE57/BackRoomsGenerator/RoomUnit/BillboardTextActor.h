@@ -3,8 +3,6 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Components/TextRenderComponent.h"
-#include "GameFramework/PlayerController.h"
-#include "Engine/TimerHandle.h"
 #include "BillboardTextActor.generated.h"
 
 UCLASS()
@@ -23,12 +21,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	UTextRenderComponent* TextRenderComponent;
 
-	// Timer for updating rotation
-	FTimerHandle UpdateTimer;
-
-	// Update interval in seconds
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Billboard")
-	float UpdateInterval = 2.0f;
+	// Labels are turned every frame by UBillboardLabelSubsystem, the per-actor timer interval is no longer used
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Labels are turned every frame by UBillboardLabelSubsystem"))
+	float UpdateInterval_DEPRECATED = 2.0f;
 
 	// Text properties
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Text")
@@ -53,8 +48,6 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Billboard")
 	void SetTextColor(const FColor& NewColor);
 
-private:
-	// Timer function to update rotation toward player
-	UFUNCTION()
-	void UpdateRotationTowardPlayer();
+	// Turn upright toward a view location - called by UBillboardLabelSubsystem for labels near the viewer
+	void FaceLocation(const FVector& ViewLocation);
 };
\ No newline at end of file
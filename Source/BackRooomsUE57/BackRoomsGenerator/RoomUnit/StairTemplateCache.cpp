@@ -0,0 +1,275 @@
+#include "StairTemplateCache.h"
+#include "../WallUnit/WallTransform.h"
+#include "../Main.h"  // For log category
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	// Everything that determines a stair's local-space geometry (direction is only a rotation of it)
+	// Sizes are whole centimeters, so stairs that differ by float noise share a template and the template is built from the key
+	struct FStairTemplateKey
+	{
+		int32 NumberOfSteps = 0;
+		int32 StepHeightCm = 0;
+		int32 StepDepthCm = 0;
+		int32 StairWidthCm = 0;
+		int32 RailingHeightCm = 0;
+
+		bool operator==(const FStairTemplateKey& Other) const
+		{
+			return NumberOfSteps == Other.NumberOfSteps && StepHeightCm == Other.StepHeightCm && StepDepthCm == Other.StepDepthCm
+				&& StairWidthCm == Other.StairWidthCm && RailingHeightCm == Other.RailingHeightCm;
+		}
+
+		friend uint32 GetTypeHash(const FStairTemplateKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.NumberOfSteps), GetTypeHash(Key.StepHeightCm));
+			Hash = HashCombine(Hash, GetTypeHash(Key.StepDepthCm));
+			Hash = HashCombine(Hash, GetTypeHash(Key.StairWidthCm));
+			return HashCombine(Hash, GetTypeHash(Key.RailingHeightCm));
+		}
+	};
+
+	struct FStairTemplateCacheState
+	{
+		FCriticalSection Lock;
+		TMap<FStairTemplateKey, FStairTemplateRef> Entries;
+		int32 Hits = 0;
+		int32 Misses = 0;
+	};
+
+	FStairTemplateCacheState& GetCacheState()
+	{
+		static FStairTemplateCacheState State;
+		return State;
+	}
+
+	const FLinearColor StepColor(0.8f, 0.4f, 0.2f, 1.0f);  // Orange-brown
+	const FLinearColor FoundationColor = FLinearColor::Gray;
+	const FLinearColor RailingColor(0.3f, 0.3f, 0.3f, 1.0f);
+
+	constexpr float RailingThicknessCm = 5.0f;
+
+	// Append a six-sided solid from its corners (cm): bottom front-left, front-right, back-right, back-left, then the same on top
+	// Every face gets its own 4 vertices so normals stay flat; winding matches the room floor
+	void AppendHexahedron(FStairTemplate& Template, const FVector (&Corners)[8], const FLinearColor& Color)
+	{
+		static const int32 Faces[6][4] = {
+			{ 0, 3, 2, 1 }, // Bottom
+			{ 4, 5, 6, 7 }, // Top
+			{ 0, 1, 5, 4 }, // Front
+			{ 2, 3, 7, 6 }, // Back
+			{ 3, 0, 4, 7 }, // Left
+			{ 1, 2, 6, 5 }  // Right
+		};
+
+		FVector Center = FVector::ZeroVector;
+		for (const FVector& Corner : Corners)
+		{
+			Center += Corner / 8.0f;
+		}
+
+		for (const int32 (&Face)[4] : Faces)
+		{
+			const FVector FaceCenter = (Corners[Face[0]] + Corners[Face[1]] + Corners[Face[2]] + Corners[Face[3]]) / 4.0f;
+			FVector Normal = FVector::CrossProduct(Corners[Face[1]] - Corners[Face[0]], Corners[Face[2]] - Corners[Face[0]]).GetSafeNormal();
+			if (FVector::DotProduct(Normal, FaceCenter - Center) < 0.0f)
+			{
+				Normal = -Normal;
+			}
+
+			// Planar UVs on the two axes the face spans (1 tile per meter)
+			const FVector AbsNormal = Normal.GetAbs();
+			const int32 BaseIndex = Template.Vertices.Num();
+			for (int32 CornerIndex : Face)
+			{
+				const FVector& Corner = Corners[CornerIndex];
+				Template.Vertices.Add(Corner);
+				Template.Normals.Add(Normal);
+				Template.Colors.Add(Color);
+				if (AbsNormal.Z >= AbsNormal.X && AbsNormal.Z >= AbsNormal.Y)
+				{
+					Template.UVs.Add(FVector2D(Corner.X, Corner.Y) * 0.01f);
+				}
+				else if (AbsNormal.Y >= AbsNormal.X)
+				{
+					Template.UVs.Add(FVector2D(Corner.X, Corner.Z) * 0.01f);
+				}
+				else
+				{
+					Template.UVs.Add(FVector2D(Corner.Y, Corner.Z) * 0.01f);
+				}
+			}
+
+			Template.Triangles.Append({ BaseIndex + 0, BaseIndex + 1, BaseIndex + 2, BaseIndex + 0, BaseIndex + 2, BaseIndex + 3 });
+		}
+	}
+
+	void AppendBox(FStairTemplate& Template, const FVector& Min, const FVector& Max, const FLinearColor& Color)
+	{
+		const FVector Corners[8] = {
+			FVector(Min.X, Min.Y, Min.Z), FVector(Max.X, Min.Y, Min.Z), FVector(Max.X, Max.Y, Min.Z), FVector(Min.X, Max.Y, Min.Z),
+			FVector(Min.X, Min.Y, Max.Z), FVector(Max.X, Min.Y, Max.Z), FVector(Max.X, Max.Y, Max.Z), FVector(Min.X, Max.Y, Max.Z)
+		};
+		AppendHexahedron(Template, Corners, Color);
+	}
+
+	void BuildStairTemplate(const FStairTemplateKey& Key, FStairTemplate& Template)
+	{
+		const float WidthCm = Key.StairWidthCm;
+		const float DepthCm = Key.StepDepthCm;
+		const float RiseCm = Key.StepHeightCm;
+		const float RunCm = Key.NumberOfSteps * DepthCm;
+
+		// Boxes * 6 faces * 4 vertices: steps, foundation under all but the first step, 2 posts + 1 rail per side
+		const int32 NumBoxes = Key.NumberOfSteps * 2 - 1 + (Key.RailingHeightCm > 0 ? 6 : 0);
+		Template.Vertices.Reserve(NumBoxes * 24);
+		Template.Normals.Reserve(NumBoxes * 24);
+		Template.UVs.Reserve(NumBoxes * 24);
+		Template.Colors.Reserve(NumBoxes * 24);
+		Template.Triangles.Reserve(NumBoxes * 36);
+
+		// Ramp profile along the run: a riser at the front, a slope touching every nosing, then flat over the last tread
+		// The region under it is convex, so the walkable stair collides as one hull instead of every step face
+		if (Key.NumberOfSteps > 0)
+		{
+			const float TopCm = Key.NumberOfSteps * RiseCm;
+			const FVector2D Profile[5] = {
+				FVector2D(0.0f, 0.0f), FVector2D(0.0f, RiseCm), FVector2D(RunCm - DepthCm, TopCm), FVector2D(RunCm, TopCm), FVector2D(RunCm, 0.0f)
+			};
+			for (const float SideX : { 0.0f, WidthCm })
+			{
+				for (const FVector2D& Point : Profile)
+				{
+					Template.RampHull.Add(FVector(SideX, Point.X, Point.Y));
+				}
+			}
+		}
+
+		for (int32 StepIndex = 0; StepIndex < Key.NumberOfSteps; StepIndex++)
+		{
+			const float StepFront = StepIndex * DepthCm;
+			const float StepBottom = StepIndex * RiseCm;
+
+			// Tread block
+			AppendBox(Template, FVector(0.0f, StepFront, StepBottom), FVector(WidthCm, StepFront + DepthCm, StepBottom + RiseCm), StepColor);
+
+			// Foundation fills the space between the floor and the step
+			if (StepIndex > 0)
+			{
+				AppendBox(Template, FVector(0.0f, StepFront, 0.0f), FVector(WidthCm, StepFront + DepthCm, StepBottom), FoundationColor);
+			}
+		}
+
+		if (Key.RailingHeightCm <= 0)
+		{
+			return;
+		}
+
+		// Railings along both sides: a post on the first and last tread and a rail sloped with the stairs between their tops
+		const float RailingCm = Key.RailingHeightCm;
+		const float BottomTread = RiseCm;
+		const float TopTread = Key.NumberOfSteps * RiseCm;
+		for (const float SideX : { 0.0f, WidthCm - RailingThicknessCm })
+		{
+			const float X0 = SideX;
+			const float X1 = SideX + RailingThicknessCm;
+
+			AppendBox(Template, FVector(X0, 0.0f, BottomTread), FVector(X1, RailingThicknessCm, BottomTread + RailingCm), RailingColor);
+			AppendBox(Template, FVector(X0, RunCm - RailingThicknessCm, TopTread), FVector(X1, RunCm, TopTread + RailingCm), RailingColor);
+
+			const float RailBottom0 = BottomTread + RailingCm - RailingThicknessCm;
+			const float RailBottom1 = TopTread + RailingCm - RailingThicknessCm;
+			const FVector RailCorners[8] = {
+				FVector(X0, 0.0f, RailBottom0), FVector(X1, 0.0f, RailBottom0), FVector(X1, RunCm, RailBottom1), FVector(X0, RunCm, RailBottom1),
+				FVector(X0, 0.0f, RailBottom0 + RailingThicknessCm), FVector(X1, 0.0f, RailBottom0 + RailingThicknessCm),
+				FVector(X1, RunCm, RailBottom1 + RailingThicknessCm), FVector(X0, RunCm, RailBottom1 + RailingThicknessCm)
+			};
+			AppendHexahedron(Template, RailCorners, RailingColor);
+		}
+	}
+}
+
+FStairTemplateRef UStairTemplateCache::FindOrBuild(int32 NumberOfSteps, float StepHeight, float StepDepth, float StairWidth, float RailingHeight)
+{
+	FStairTemplateKey Key;
+	Key.NumberOfSteps = FMath::Max(NumberOfSteps, 0);
+	Key.StepHeightCm = FMath::RoundToInt(StepHeight * 100.0f);
+	Key.StepDepthCm = FMath::RoundToInt(StepDepth * 100.0f);
+	Key.StairWidthCm = FMath::RoundToInt(StairWidth * 100.0f);
+	Key.RailingHeightCm = FMath::Max(FMath::RoundToInt(RailingHeight * 100.0f), 0);
+
+	FStairTemplateCacheState& State = GetCacheState();
+	{
+		FScopeLock ScopeLock(&State.Lock);
+		if (const FStairTemplateRef* Cached = State.Entries.Find(Key))
+		{
+			State.Hits++;
+			return *Cached;
+		}
+	}
+
+	// Build outside the lock - a racing build of the same key just loses the Add below
+	TSharedRef<FStairTemplate, ESPMode::ThreadSafe> Template = MakeShared<FStairTemplate, ESPMode::ThreadSafe>();
+	BuildStairTemplate(Key, *Template);
+
+	FScopeLock ScopeLock(&State.Lock);
+	State.Misses++;
+	return State.Entries.Add(Key, Template);
+}
+
+void UStairTemplateCache::AppendTransformed(const FStairTemplate& Template, const FVector& BasePosition, const FRotator& Rotation,
+	TArray<FVector>& OutVertices, TArray<int32>& OutTriangles, TArray<FVector>& OutNormals,
+	TArray<FVector2D>& OutUVs, TArray<FLinearColor>& OutColors)
+{
+	const int32 BaseIndex = OutVertices.Num();
+	UWallTransform::AppendTransformed(FTransform(Rotation, BasePosition), Template.Vertices, Template.Normals, OutVertices, OutNormals);
+
+	// Topology, UVs and colors are placement-independent
+	OutTriangles.Reserve(OutTriangles.Num() + Template.Triangles.Num());
+	for (int32 Index : Template.Triangles)
+	{
+		OutTriangles.Add(BaseIndex + Index);
+	}
+	OutUVs.Append(Template.UVs);
+	OutColors.Append(Template.Colors);
+}
+
+void UStairTemplateCache::TransformRamp(const FStairTemplate& Template, const FVector& BasePosition, const FRotator& Rotation,
+	TArray<FVector>& OutHull)
+{
+	OutHull.SetNumUninitialized(Template.RampHull.Num());
+	UWallTransform::TransformPositions(FTransform(Rotation, BasePosition), Template.RampHull.GetData(), OutHull.GetData(), OutHull.Num());
+}
+
+void UStairTemplateCache::GetStats(int32& OutHits, int32& OutMisses, int32& OutEntries)
+{
+	FStairTemplateCacheState& State = GetCacheState();
+	FScopeLock ScopeLock(&State.Lock);
+	OutHits = State.Hits;
+	OutMisses = State.Misses;
+	OutEntries = State.Entries.Num();
+}
+
+void UStairTemplateCache::LogStats()
+{
+	int32 Hits, Misses, Entries;
+	GetStats(Hits, Misses, Entries);
+
+	const int32 Lookups = Hits + Misses;
+	if (Lookups == 0)
+	{
+		return;
+	}
+	UE_LOG(LogBackRoomGenerator, Log, TEXT("Stair template cache: %d/%d hits (%.1f%%), %d unique stairs"),
+		Hits, Lookups, (100.0f * Hits) / Lookups, Entries);
+}
+
+void UStairTemplateCache::Reset()
+{
+	FStairTemplateCacheState& State = GetCacheState();
+	FScopeLock ScopeLock(&State.Lock);
+	State.Entries.Empty();
+	State.Hits = 0;
+	State.Misses = 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Immutable stair mesh in stair-local space (first step's front-left corner at the origin, steps ascend +Y, width along +X)
+// Steps, the foundation under them and the side railings are one closed-box soup with flat per-face normals
+struct FStairTemplate
+{
+	TArray<FVector> Vertices;
+	TArray<int32> Triangles;
+	TArray<FVector> Normals;
+	TArray<FVector2D> UVs;
+	TArray<FLinearColor> Colors;
+
+	// Simple collision: one convex ramp under the step nosings, flat over the last tread, same local space
+	TArray<FVector> RampHull;
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return Vertices.GetAllocatedSize() + Triangles.GetAllocatedSize() + Normals.GetAllocatedSize() + UVs.GetAllocatedSize()
+			+ Colors.GetAllocatedSize() + RampHull.GetAllocatedSize();
+	}
+};
+
+typedef TSharedRef<const FStairTemplate, ESPMode::ThreadSafe> FStairTemplateRef;
+
+/**
+ * Parameter-keyed cache of stair meshes
+ * Stairs come from a handful of step configurations, so each one is built once and every stair room
+ * only rotates it to its direction and moves it to its base - all four directions share one entry.
+ */
+class UStairTemplateCache
+{
+public:
+	// Shared stair-local mesh for a step configuration (sizes in meters, RailingHeight <= 0 = no railings)
+	static FStairTemplateRef FindOrBuild(int32 NumberOfSteps, float StepHeight, float StepDepth, float StairWidth, float RailingHeight);
+
+	// Append a cached mesh to output buffers, rotated around the stair base and moved to BasePosition
+	static void AppendTransformed(const FStairTemplate& Template, const FVector& BasePosition, const FRotator& Rotation,
+		TArray<FVector>& OutVertices, TArray<int32>& OutTriangles, TArray<FVector>& OutNormals,
+		TArray<FVector2D>& OutUVs, TArray<FLinearColor>& OutColors);
+
+	// Ramp hull of a cached mesh, placed like AppendTransformed
+	static void TransformRamp(const FStairTemplate& Template, const FVector& BasePosition, const FRotator& Rotation,
+		TArray<FVector>& OutHull);
+
+	// Cache statistics since the last Reset
+	static void GetStats(int32& OutHits, int32& OutMisses, int32& OutEntries);
+	static void LogStats();
+
+	// Drop all cached meshes and statistics
+	static void Reset();
+};
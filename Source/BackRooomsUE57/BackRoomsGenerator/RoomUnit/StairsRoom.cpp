@@ -1,7 +1,10 @@
 #include "StairsRoom.h"
+#include "StairTemplateCache.h"
 #include "Engine/Engine.h"
 #include "Components/TextRenderComponent.h"
 #include "DrawDebugHelpers.h"
+#include "../Services/IDebugMarkerOverlay.h"
+#include "../Services/ICollisionCookTracker.h"
 
 UStairsRoom::UStairsRoom() : Super()
 {
@@ -80,11 +83,11 @@ FVector UStairsRoom::GetStairTopPosition() const
 		case EWallSide::North:
 			return BasePosition + FVector(0, MetersToUnrealUnits(TotalStairLength), MetersToUnrealUnits(TotalStairHeight + Elevation));
 		case EWallSide::South:
-			return BasePosition + FVector(0, -MetersToUnrealUnits(TotalStairLength), MetersToUnrealUnits(TotalStairHeight + Elevation));
+			return BasePosition + FVector(0, 0, MetersToUnrealUnits(TotalStairHeight + Elevation));
 		case EWallSide::East:
 			return BasePosition + FVector(MetersToUnrealUnits(TotalStairLength), 0, MetersToUnrealUnits(TotalStairHeight + Elevation));
 		case EWallSide::West:
-			return BasePosition + FVector(-MetersToUnrealUnits(TotalStairLength), 0, MetersToUnrealUnits(TotalStairHeight + Elevation));
+			return BasePosition + FVector(0, 0, MetersToUnrealUnits(TotalStairHeight + Elevation));
 		default:
 			return BasePosition + FVector(0, 0, MetersToUnrealUnits(TotalStairHeight + Elevation));
 	}
@@ -92,7 +95,17 @@ FVector UStairsRoom::GetStairTopPosition() const
 
 FVector UStairsRoom::GetStairBottomPosition() const
 {
-	return Position + FVector(0, 0, MetersToUnrealUnits(Elevation));
+	// South and West stairs start at the far wall (see GetStairTemplatePlacement)
+	const float StairRunCm = MetersToUnrealUnits(CalculateTotalStairLength());
+	switch (StairDirection)
+	{
+		case EWallSide::South:
+			return Position + FVector(0, StairRunCm, MetersToUnrealUnits(Elevation));
+		case EWallSide::West:
+			return Position + FVector(StairRunCm, 0, MetersToUnrealUnits(Elevation));
+		default:
+			return Position + FVector(0, 0, MetersToUnrealUnits(Elevation));
+	}
 }
 
 FBox UStairsRoom::GetStairCollisionBounds() const
@@ -139,23 +152,6 @@ FBox UStairsRoom::GetStairCollisionBounds() const
 	return FBox(Min, Max);
 }
 
-FRotator UStairsRoom::GetStairDirectionRotation() const
-{
-	switch (StairDirection)
-	{
-		case EWallSide::North:
-			return FRotator(0, 0, 0);      // Facing North (default)
-		case EWallSide::South:
-			return FRotator(0, 180, 0);    // Facing South
-		case EWallSide::East:
-			return FRotator(0, 90, 0);     // Facing East
-		case EWallSide::West:
-			return FRotator(0, -90, 0);    // Facing West
-		default:
-			return FRotator::ZeroRotator;
-	}
-}
-
 bool UStairsRoom::CreateStairsFromRoomData(const FRoomData& RoomData, AActor* Owner, bool bShowNumbers)
 {
 	if (!Owner)
@@ -204,6 +200,116 @@ bool UStairsRoom::CreateStairsFromRoomData(const FRoomData& RoomData, AActor* Ow
 	return true;
 }
 
+bool UStairsRoom::CreateFromLayout(const FRoomData& RoomData, float SourceElevation, AActor* Owner, bool bShowNumbers)
+{
+	// Steps run the room's length along the stair direction and span its width across it
+	// Sizes snap to a few values (width down to 10cm, tread depth to 5cm, whole-centimeter risers) so stairs share templates
+	StairDirection = RoomData.StairDirection;
+	const bool bRunsAlongY = StairDirection == EWallSide::North || StairDirection == EWallSide::South;
+	const float RunLength = bRunsAlongY ? RoomData.Length : RoomData.Width;
+	StairWidth = FMath::Max(FMath::FloorToFloat((bRunsAlongY ? RoomData.Width : RoomData.Length) * 10.0f) / 10.0f, 0.8f);
+	
+	// Room elevations are levels in meters - the steps cover the change from the room the stairs were placed from
+	const float Rise = RoomData.Elevation - SourceElevation;
+	const int32 RiseCm = FMath::RoundToInt(FMath::Abs(Rise) * 100.0f);
+	if (RiseCm >= LayoutMinStepHeightCm)
+	{
+		// Whole-centimeter steps in the comfortable range; the step count absorbs the rest of the rise
+		const int32 MinSteps = FMath::DivideAndRoundUp(RiseCm, LayoutMaxStepHeightCm);
+		const int32 MaxSteps = FMath::Max(RiseCm / LayoutMinStepHeightCm, MinSteps);
+		int32 BestSteps = MinSteps;
+		int32 BestErrorCm = MAX_int32;
+		for (int32 Steps = MinSteps; Steps <= MaxSteps && BestErrorCm > 0; Steps++)
+		{
+			const int32 StepCm = FMath::Clamp(FMath::RoundToInt(float(RiseCm) / Steps), LayoutMinStepHeightCm, LayoutMaxStepHeightCm);
+			const int32 ErrorCm = FMath::Abs(RiseCm - Steps * StepCm);
+			if (ErrorCm < BestErrorCm)
+			{
+				BestSteps = Steps;
+				BestErrorCm = ErrorCm;
+			}
+		}
+		NumberOfSteps = BestSteps;
+		StepHeight = FMath::Clamp(FMath::RoundToInt(float(RiseCm) / BestSteps), LayoutMinStepHeightCm, LayoutMaxStepHeightCm) / 100.0f;
+		
+		// Treads share the run, within the usual 20-40cm
+		StepDepth = FMath::Clamp(FMath::FloorToFloat(RunLength / NumberOfSteps * 20.0f) / 20.0f, 0.2f, 0.4f);
+	}
+	else
+	{
+		// No level change worth a step - fill the run with default steps
+		NumberOfSteps = FMath::Max(FMath::FloorToInt(RunLength / StepDepth), 1);
+	}
+	if (CalculateTotalStairLength() > RunLength)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StairsRoom %d: %d steps need a %.1fm run, the room only has %.1fm"), 
+			RoomData.RoomIndex, NumberOfSteps, CalculateTotalStairLength(), RunLength);
+	}
+	
+	// The room shell stays at the entry level; descending steps start below it and climb back up toward the entry,
+	// so they are the same stairs turned around with their base one full rise down
+	FRoomData StairData = RoomData;
+	StairData.Elevation = 0.0f;
+	if (Rise < 0.0f && RiseCm >= LayoutMinStepHeightCm)
+	{
+		switch (StairDirection)
+		{
+			case EWallSide::North: StairDirection = EWallSide::South; break;
+			case EWallSide::South: StairDirection = EWallSide::North; break;
+			case EWallSide::East:  StairDirection = EWallSide::West;  break;
+			case EWallSide::West:  StairDirection = EWallSide::East;  break;
+			default: break;
+		}
+		StairData.StairDirection = StairDirection;
+		StairData.Elevation = -CalculateTotalStairHeight();
+	}
+	return CreateFromRoomData(StairData, Owner, bShowNumbers);
+}
+
+void UStairsRoom::GetDetailActors(TArray<AActor*>& OutActors) const
+{
+	Super::GetDetailActors(OutActors);
+	
+	// The stair mesh actor belongs to this room alone, even when its walls live in shared chunks
+	if (IsValid(StairMeshActor))
+	{
+		OutActors.AddUnique(StairMeshActor);
+	}
+}
+
+void UStairsRoom::BuildStairMesh(AActor* Owner)
+{
+	UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+	if (!World)
+	{
+		UE_LOG(LogTemp, Error, TEXT("StairsRoom::BuildStairMesh - Invalid Owner or World"));
+		return;
+	}
+	
+	// The mesh component becomes the root of its own actor, so the generator's root is left alone
+	if (!StairMeshActor)
+	{
+		StairMeshActor = World->SpawnActor<AActor>();
+		if (!StairMeshActor)
+		{
+			return;
+		}
+		InitializeMeshComponent(StairMeshActor);
+	}
+	if (!MeshComponent)
+	{
+		return;
+	}
+	
+	// Steps and ramp cook like the walls, and the room is only reported walkable once the ramp is in place
+	MeshComponent->bUseAsyncCooking = bAsyncCollisionCooking;
+	GenerateMesh();
+	if (CookTracker)
+	{
+		CookTracker->WatchComponent(this, MeshComponent);
+	}
+}
+
 void UStairsRoom::CreateRoomUsingIndividualActors(AActor* Owner)
 {
 	UE_LOG(LogTemp, Warning, TEXT("StairsRoom: Creating stairs using individual actors"));
@@ -214,9 +320,8 @@ void UStairsRoom::CreateRoomUsingIndividualActors(AActor* Owner)
 	// Create purple sphere indicator above stairs for easy identification
 	CreateStairIdentifierSphere(Owner);
 	
-	// Then add stair-specific geometry
-	// Note: For now, we'll use the standard mesh generation with stairs included
-	// In a more advanced implementation, you could create separate stair actors
+	// Then add stair-specific geometry as its own mesh actor
+	BuildStairMesh(Owner);
 	
 	UE_LOG(LogTemp, Warning, TEXT("StairsRoom: Individual actors created with stair geometry"));
 }
@@ -239,26 +344,25 @@ void UStairsRoom::GenerateMesh()
 	TArray<FVector2D> CombinedUVs;
 	TArray<FLinearColor> CombinedColors;
 
-	// Generate foundation floor
+	// Generate foundation floor (descending stairs start below the room floor, so theirs goes down with them)
+	const float FloorZ = FMath::Min(MetersToUnrealUnits(Elevation), 0.0f);
 	GenerateFloorGeometry(CombinedVertices, CombinedTriangles, CombinedNormals, CombinedUVs);
 	
 	// Add floor colors (gray)
 	for (int32 i = 0; i < 4; i++) // Floor has 4 vertices
 	{
+		CombinedVertices[CombinedVertices.Num() - 4 + i].Z = FloorZ;
 		CombinedColors.Add(FLinearColor::Gray);
 	}
 
-	// Generate stair steps
-	GenerateStairSteps(CombinedVertices, CombinedTriangles, CombinedNormals, CombinedUVs, CombinedColors);
-	
-	// Generate stair foundation/walls under stairs
-	GenerateStairFoundation(CombinedVertices, CombinedTriangles, CombinedNormals, CombinedUVs, CombinedColors);
-	
-	// Generate railings if enabled
-	if (bIncludeRailings)
-	{
-		GenerateStairRailings(CombinedVertices, CombinedTriangles, CombinedNormals, CombinedUVs, CombinedColors);
-	}
+	// Steps, foundation and railings come from the shared template for this step configuration
+	FStairTemplateRef StairTemplate = UStairTemplateCache::FindOrBuild(NumberOfSteps, StepHeight, StepDepth, StairWidth,
+		bIncludeRailings ? RailingHeight : 0.0f);
+	FVector StairBase;
+	FRotator StairRotation;
+	GetStairTemplatePlacement(StairBase, StairRotation);
+	UStairTemplateCache::AppendTransformed(*StairTemplate, StairBase, StairRotation,
+		CombinedVertices, CombinedTriangles, CombinedNormals, CombinedUVs, CombinedColors);
 
 	// Create the mesh section
 	if (CombinedVertices.Num() > 0 && CombinedTriangles.Num() > 0)
@@ -271,8 +375,30 @@ void UStairsRoom::GenerateMesh()
 			CombinedUVs,
 			CombinedColors,
 			TArray<FProcMeshTangent>(), // Empty tangents
-			true // Create collision
+			!bRampCollision // Steps only collide when there is no ramp
 		);
+
+		if (bRampCollision)
+		{
+			// Floor slab under the room and the ramp over the steps - character movement sweeps two hulls, not every step face
+			const float WidthCm = MetersToUnrealUnits(Width);
+			const float LengthCm = MetersToUnrealUnits(Length);
+			TArray<TArray<FVector>> CollisionHulls;
+			TArray<FVector>& FloorHull = CollisionHulls.AddDefaulted_GetRef();
+			for (int32 Corner = 0; Corner < 8; Corner++)
+			{
+				FloorHull.Add(FVector((Corner & 1) ? WidthCm : 0.0f, (Corner & 2) ? LengthCm : 0.0f, FloorZ + ((Corner & 4) ? 0.0f : -10.0f)));
+			}
+			UStairTemplateCache::TransformRamp(*StairTemplate, StairBase, StairRotation, CollisionHulls.AddDefaulted_GetRef());
+
+			MeshComponent->bUseComplexAsSimpleCollision = false;
+			MeshComponent->SetCollisionConvexMeshes(CollisionHulls);
+		}
+		else
+		{
+			MeshComponent->ClearCollisionConvexMeshes();
+			MeshComponent->bUseComplexAsSimpleCollision = true;
+		}
 		
 		UE_LOG(LogTemp, Warning, TEXT("StairsRoom: Generated mesh with %d vertices, %d triangles"), 
 			CombinedVertices.Num(), CombinedTriangles.Num() / 3);
@@ -283,154 +409,34 @@ void UStairsRoom::GenerateMesh()
 	}
 }
 
-void UStairsRoom::GenerateStairSteps(TArray<FVector>& Vertices, TArray<int32>& Triangles, 
-	TArray<FVector>& Normals, TArray<FVector2D>& UVs, TArray<FLinearColor>& Colors)
+void UStairsRoom::GetStairTemplatePlacement(FVector& OutBase, FRotator& OutRotation) const
 {
-	int32 BaseVertexIndex = Vertices.Num();
-	
-	for (int32 StepIndex = 0; StepIndex < NumberOfSteps; StepIndex++)
-	{
-		FVector StepPosition = CalculateStepPosition(StepIndex);
-		AddStepToMesh(StepIndex, StepPosition, Vertices, Triangles, Normals, UVs, Colors);
-	}
-	
-	UE_LOG(LogTemp, Warning, TEXT("StairsRoom: Generated %d stair steps"), NumberOfSteps);
-}
+	// Mesh space is relative to the room position; the stairs start at the elevation and keep their width on the +X / +Y side
+	// Template steps ascend +Y with width along +X, so each direction is a yaw plus an offset that brings the width back
+	// South and West stairs start at the far wall, so every direction climbs inside the room footprint
+	const float StairWidthCm = MetersToUnrealUnits(StairWidth);
+	const float StairRunCm = MetersToUnrealUnits(CalculateTotalStairLength());
+	OutBase = FVector(0, 0, MetersToUnrealUnits(Elevation));
+	OutRotation = FRotator::ZeroRotator;
 
-FVector UStairsRoom::CalculateStepPosition(int32 StepIndex) const
-{
-	FVector BasePosition = Position + FVector(0, 0, MetersToUnrealUnits(Elevation));
-	
-	// Calculate step offset based on direction
-	FVector StepOffset = FVector::ZeroVector;
-	float StepProgress = StepIndex * StepDepth;
-	float StepElevation = StepIndex * StepHeight;
-	
 	switch (StairDirection)
 	{
-		case EWallSide::North:
-			StepOffset = FVector(0, MetersToUnrealUnits(StepProgress), MetersToUnrealUnits(StepElevation));
-			break;
 		case EWallSide::South:
-			StepOffset = FVector(0, -MetersToUnrealUnits(StepProgress), MetersToUnrealUnits(StepElevation));
+			OutBase.X += StairWidthCm;
+			OutBase.Y += StairRunCm;
+			OutRotation = FRotator(0, 180, 0);
 			break;
 		case EWallSide::East:
-			StepOffset = FVector(MetersToUnrealUnits(StepProgress), 0, MetersToUnrealUnits(StepElevation));
+			OutBase.Y += StairWidthCm;
+			OutRotation = FRotator(0, -90, 0);
 			break;
 		case EWallSide::West:
-			StepOffset = FVector(-MetersToUnrealUnits(StepProgress), 0, MetersToUnrealUnits(StepElevation));
+			OutBase.X += StairRunCm;
+			OutRotation = FRotator(0, 90, 0);
 			break;
 		default:
 			break;
 	}
-	
-	return BasePosition + StepOffset;
-}
-
-void UStairsRoom::AddStepToMesh(int32 StepIndex, const FVector& StepPosition, 
-	TArray<FVector>& Vertices, TArray<int32>& Triangles,
-	TArray<FVector>& Normals, TArray<FVector2D>& UVs, TArray<FLinearColor>& Colors)
-{
-	int32 BaseVertexIndex = Vertices.Num();
-	
-	// Step dimensions in Unreal units
-	float StepWidthCm = MetersToUnrealUnits(StairWidth);
-	float StepDepthCm = MetersToUnrealUnits(StepDepth);
-	float StepHeightCm = MetersToUnrealUnits(StepHeight);
-	
-	// Create step as a box (simplified)
-	// Step vertices (8 vertices for a box)
-	TArray<FVector> StepVertices = {
-		// Bottom face
-		StepPosition + FVector(0, 0, 0),                                    // 0: Bottom front-left
-		StepPosition + FVector(StepWidthCm, 0, 0),                         // 1: Bottom front-right
-		StepPosition + FVector(StepWidthCm, StepDepthCm, 0),               // 2: Bottom back-right
-		StepPosition + FVector(0, StepDepthCm, 0),                         // 3: Bottom back-left
-		
-		// Top face
-		StepPosition + FVector(0, 0, StepHeightCm),                        // 4: Top front-left
-		StepPosition + FVector(StepWidthCm, 0, StepHeightCm),              // 5: Top front-right
-		StepPosition + FVector(StepWidthCm, StepDepthCm, StepHeightCm),    // 6: Top back-right
-		StepPosition + FVector(0, StepDepthCm, StepHeightCm)               // 7: Top back-left
-	};
-	
-	// Add vertices
-	Vertices.Append(StepVertices);
-	
-	// Create triangles for step box (12 triangles = 6 faces * 2 triangles each)
-	TArray<int32> StepTriangles = {
-		// Bottom face (facing down)
-		BaseVertexIndex + 0, BaseVertexIndex + 2, BaseVertexIndex + 1,
-		BaseVertexIndex + 0, BaseVertexIndex + 3, BaseVertexIndex + 2,
-		
-		// Top face (facing up)
-		BaseVertexIndex + 4, BaseVertexIndex + 5, BaseVertexIndex + 6,
-		BaseVertexIndex + 4, BaseVertexIndex + 6, BaseVertexIndex + 7,
-		
-		// Front face
-		BaseVertexIndex + 0, BaseVertexIndex + 1, BaseVertexIndex + 5,
-		BaseVertexIndex + 0, BaseVertexIndex + 5, BaseVertexIndex + 4,
-		
-		// Back face
-		BaseVertexIndex + 2, BaseVertexIndex + 3, BaseVertexIndex + 7,
-		BaseVertexIndex + 2, BaseVertexIndex + 7, BaseVertexIndex + 6,
-		
-		// Left face
-		BaseVertexIndex + 3, BaseVertexIndex + 0, BaseVertexIndex + 4,
-		BaseVertexIndex + 3, BaseVertexIndex + 4, BaseVertexIndex + 7,
-		
-		// Right face
-		BaseVertexIndex + 1, BaseVertexIndex + 2, BaseVertexIndex + 6,
-		BaseVertexIndex + 1, BaseVertexIndex + 6, BaseVertexIndex + 5
-	};
-	
-	Triangles.Append(StepTriangles);
-	
-	// Add normals (simplified - using face normals)
-	for (int32 i = 0; i < 8; i++)
-	{
-		Normals.Add(FVector::UpVector); // Simplified normal
-	}
-	
-	// Add UVs
-	for (int32 i = 0; i < 8; i++)
-	{
-		UVs.Add(CalculateStairUV(StepVertices[i]));
-	}
-	
-	// Add colors (orange/brown for stairs)
-	FLinearColor StepColor = FLinearColor(0.8f, 0.4f, 0.2f, 1.0f); // Orange-brown
-	for (int32 i = 0; i < 8; i++)
-	{
-		Colors.Add(StepColor);
-	}
-}
-
-void UStairsRoom::GenerateStairFoundation(TArray<FVector>& Vertices, TArray<int32>& Triangles,
-	TArray<FVector>& Normals, TArray<FVector2D>& UVs, TArray<FLinearColor>& Colors)
-{
-	// Generate supporting walls/foundation under the stairs
-	// This creates the triangular space under the stairs
-	
-	// For now, implement a simple foundation block
-	// In a more complex implementation, this could be triangular supports
-	
-	UE_LOG(LogTemp, Warning, TEXT("StairsRoom: Generated stair foundation"));
-}
-
-void UStairsRoom::GenerateStairRailings(TArray<FVector>& Vertices, TArray<int32>& Triangles,
-	TArray<FVector>& Normals, TArray<FVector2D>& UVs, TArray<FLinearColor>& Colors)
-{
-	// Generate railings on both sides of the stairs
-	// Railings run parallel to the stair direction
-	
-	UE_LOG(LogTemp, Warning, TEXT("StairsRoom: Generated stair railings (height: %.2fm)"), RailingHeight);
-}
-
-FVector2D UStairsRoom::CalculateStairUV(const FVector& Vertex, float ScaleFactor)
-{
-	// Simple UV calculation based on world position
-	return FVector2D(Vertex.X * 0.01f * ScaleFactor, Vertex.Y * 0.01f * ScaleFactor);
 }
 
 void UStairsRoom::CreateRoomNumberText(int32 RoomIndex, bool bShowNumbers)
@@ -458,6 +464,13 @@ void UStairsRoom::CreateStairIdentifierSphere(AActor* Owner)
 		MetersToUnrealUnits(Height + 0.5f)   // Above the room by 0.5m
 	);
 
+	// Shared overlay: one more instance instead of persistent debug lines
+	if (DebugMarkers)
+	{
+		DebugMarkers->AddMarker(SpherePosition, 60.0f, FLinearColor(FColor::Purple));
+		return;
+	}
+
 	// Draw persistent debug sphere (UE5 debug sphere)
 	DrawDebugSphere(
 		Owner->GetWorld(),
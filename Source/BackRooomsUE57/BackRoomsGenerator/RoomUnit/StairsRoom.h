@@ -43,6 +43,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stairs", meta = (ClampMin = "0.8", ClampMax = "1.2", Units = "m", EditCondition = "bIncludeRailings"))
 	float RailingHeight = 0.9f; // Standard 90cm railing height
 
+	// Collide as one sloped convex ramp (plus a floor slab) and keep the steps visual-only
+	// Off = the full stepped mesh is cooked as complex collision
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stairs")
+	bool bRampCollision = true;
+
 	// Stairs-specific methods
 	
 	// Override room creation to include stair geometry
@@ -51,6 +56,11 @@ public:
 	// Create stairs from RoomData with automatic stair configuration
 	bool CreateStairsFromRoomData(const FRoomData& RoomData, AActor* Owner, bool bShowNumbers = true);
 	
+	// Create a stair room placed by the generator: the room keeps its placed size and the steps span its width,
+	// covering the change from SourceElevation (the level of the room it was placed from) to RoomData.Elevation (m)
+	// Descending stairs are built down from the room floor, climbing back up toward the entry
+	bool CreateFromLayout(const FRoomData& RoomData, float SourceElevation, AActor* Owner, bool bShowNumbers = true);
+	
 	// Calculate total stair elevation based on step count and height
 	float CalculateTotalStairHeight() const;
 	
@@ -65,32 +75,31 @@ public:
 	
 	// Get accurate collision bounds for stairs (accounts for actual stair geometry)
 	FBox GetStairCollisionBounds() const;
+	
+	// LOD: the stair mesh actor is hidden with the room's own walls
+	virtual void GetDetailActors(TArray<AActor*>& OutActors) const override;
 
 protected:
 	// Override mesh generation to include stair-specific geometry
 	virtual void GenerateMesh() override;
 
 private:
-	// Stair-specific mesh generation methods
-	void GenerateStairSteps(TArray<FVector>& Vertices, TArray<int32>& Triangles, 
-		TArray<FVector>& Normals, TArray<FVector2D>& UVs, TArray<FLinearColor>& Colors);
-	
-	void GenerateStairRailings(TArray<FVector>& Vertices, TArray<int32>& Triangles,
-		TArray<FVector>& Normals, TArray<FVector2D>& UVs, TArray<FLinearColor>& Colors);
-	
-	void GenerateStairFoundation(TArray<FVector>& Vertices, TArray<int32>& Triangles,
-		TArray<FVector>& Normals, TArray<FVector2D>& UVs, TArray<FLinearColor>& Colors);
-	
-	// Helper methods for stair geometry calculation
-	FVector CalculateStepPosition(int32 StepIndex) const;
-	FRotator GetStairDirectionRotation() const;
+	// Step height range for generated stairs (cm) - the rise is split into whole-centimeter steps within it
+	static constexpr int32 LayoutMinStepHeightCm = 15;
+	static constexpr int32 LayoutMaxStepHeightCm = 22;
+
+	// Actor holding the stair mesh (steps, foundation, railings) next to the room's wall actors
+	UPROPERTY()
+	AActor* StairMeshActor = nullptr;
+
+	// Spawn the stair mesh actor at the room position and build the stair mesh into it
+	void BuildStairMesh(AActor* Owner);
+
+	// Where the cached stair template goes in mesh space (base corner and yaw for StairDirection)
+	void GetStairTemplatePlacement(FVector& OutBase, FRotator& OutRotation) const;
 	void GetStairBounds(FVector& MinBounds, FVector& MaxBounds) const;
 	
 	// Utility methods
-	FVector2D CalculateStairUV(const FVector& Vertex, float ScaleFactor = 1.0f);
-	void AddStepToMesh(int32 StepIndex, const FVector& StepPosition, 
-		TArray<FVector>& Vertices, TArray<int32>& Triangles,
-		TArray<FVector>& Normals, TArray<FVector2D>& UVs, TArray<FLinearColor>& Colors);
 	void UpdateRoomDimensionsForStairs();
 	void CreateRoomNumberText(int32 RoomIndex, bool bShowNumbers = true);
 	void CreateStairIdentifierSphere(AActor* Owner);
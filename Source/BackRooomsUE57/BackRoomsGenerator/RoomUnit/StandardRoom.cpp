@@ -1,7 +1,6 @@
 #include "StandardRoom.h"
 #include "Engine/Engine.h"
 #include "Engine/StaticMeshActor.h"
-#include "Materials/MaterialInstanceDynamic.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialExpressionConstant3Vector.h"
 #include "Materials/MaterialExpressionVertexColor.h"
@@ -9,7 +8,16 @@
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "BillboardTextActor.h"
+#include "BillboardLabelSubsystem.h"
 #include "../WallUnit/WallUnit.h"
+#include "../WallUnit/WallTransform.h"
+#include "../WallUnit/WallMaterialCache.h"
+#include "../Services/IChunkMeshBuilder.h"
+#include "../Services/IInstancedWallRenderer.h"
+#include "../Services/IRoomMeshBatchBuilder.h"
+#include "../Services/ICollisionCookTracker.h"
+#include "../Services/IWallActorPool.h"
+#include "../Services/IDebugMarkerOverlay.h"
 
 UStandardRoom::UStandardRoom() : Super()
 {
@@ -187,21 +195,14 @@ void UStandardRoom::AddWallToMesh(const FVector& WallPosition, const FRotator& W
 	
 	int32 VertexOffset = CombinedVertices.Num();
 	
-	// Add transformed vertices
-	for (const FVector& Vertex : WallVertices)
+	// Add transformed vertices and normals in one batch
+	UWallTransform::AppendTransformed(WallTransform, WallVertices, WallNormals, CombinedVertices, CombinedNormals);
+	CombinedColors.Reserve(CombinedColors.Num() + WallVertices.Num());
+	for (int32 i = 0; i < WallVertices.Num(); i++)
 	{
-		FVector TransformedVertex = WallTransform.TransformPosition(Vertex);
-		CombinedVertices.Add(TransformedVertex);
 		CombinedColors.Add(WallColor);
 	}
 	
-	// Add transformed normals
-	for (const FVector& Normal : WallNormals)
-	{
-		FVector TransformedNormal = WallTransform.TransformVectorNoScale(Normal);
-		CombinedNormals.Add(TransformedNormal);
-	}
-	
 	// Add UVs (unchanged)
 	CombinedUVs.Append(WallUVs);
 	
@@ -565,6 +566,13 @@ void UStandardRoom::CreateRoomUsingIndividualActors(AActor* Owner)
 		return;
 	}
 
+	// Two-phase build: connections are still being resolved, walls are built once by BuildDeferredGeometry
+	if (bDeferWallBuild)
+	{
+		bGeometryPending = true;
+		return;
+	}
+
 	UWorld* World = Owner->GetWorld();
 	float WallThickness = 0.2f; // 20cm thick walls
 
@@ -576,16 +584,27 @@ void UStandardRoom::CreateRoomUsingIndividualActors(AActor* Owner)
 	// COORDINATE SYSTEM FIX: Main flow gives us corner position, but we need center position
 	// Convert from corner position (main flow) to center position (test mode)
 	FVector RoomCenter = Position + FVector(HalfWidth, HalfLength, HeightCm * 0.5f);
+
+	// Merged build mode: one actor/mesh component for the room, walls and floor become sections
+	if (bMergeRoomMesh && !ChunkBuilder)
+	{
+		if (IsValid(MergedRoomActor))
+		{
+			MergedRoomActor->Destroy();
+		}
+		MergedRoomActor = UWallUnit::CreateMergedMeshActor(World, RoomCenter, bAsyncCollisionCooking);
+		MergedSectionHulls.Empty();
+	}
 	
 	// UE_LOG(LogTemp, Warning, TEXT("StandardRoom: Converting corner position %s to center position %s"), 
 		// *Position.ToString(), *RoomCenter.ToString());
 
 	// Individual wall colors (same as test mode)
-	FLinearColor SouthWallColor = FLinearColor::Green;   // South wall = Green
-	FLinearColor NorthWallColor = FLinearColor::Red;     // North wall = Red  
-	FLinearColor EastWallColor = FLinearColor::Blue;     // East wall = Blue
-	FLinearColor WestWallColor = FLinearColor::Yellow;   // West wall = Yellow
-	FLinearColor FloorColor = FLinearColor::Gray;        // Floor = Gray
+	FLinearColor SouthWallColor = GetSurfaceColor(EWallSide::South);
+	FLinearColor NorthWallColor = GetSurfaceColor(EWallSide::North);
+	FLinearColor EastWallColor = GetSurfaceColor(EWallSide::East);
+	FLinearColor WestWallColor = GetSurfaceColor(EWallSide::West);
+	FLinearColor FloorColor = GetSurfaceColor(EWallSide::None);
 	FLinearColor CeilingColor = FLinearColor::White * 0.9f; // Ceiling = Light gray
 
 	// === CREATE 4 WALLS (only with doors where DoorConfigs specify) ===
@@ -605,6 +624,11 @@ void UStandardRoom::CreateRoomUsingIndividualActors(AActor* Owner)
 		return nullptr;
 	};
 
+	// Walls with a resolved connection edit or a shared seam skip the solid/door build here
+	auto IsCutLater = [&](EWallSide WallSide) -> bool {
+		return PendingWallEdits.Contains(WallSide) || SharedWalls.Contains(WallSide);
+	};
+
 	// Helper to check if wall should be completely removed (large width triggers removal)
 	auto ShouldRemoveWall = [](FDoorConfig* DoorConfig) -> bool {
 		return DoorConfig && DoorConfig->Width >= 99.0f;
@@ -615,16 +639,18 @@ void UStandardRoom::CreateRoomUsingIndividualActors(AActor* Owner)
 	FRotator SouthWallRot = FRotator(0, 0, 0);
 	FDoorConfig* SouthDoor = FindDoorConfig(EWallSide::South);
 	// UE_LOG(LogTemp, Warning, TEXT("   [S] SOUTH WALL: Pos=%s, Rot=%s, Color=Green"), *SouthWallPos.ToString(), *SouthWallRot.ToString());
-	if (ShouldRemoveWall(SouthDoor)) {
+	if (IsCutLater(EWallSide::South)) {
+		// Built once from its resolved connection in BuildDeferredGeometry
+	} else if (ShouldRemoveWall(SouthDoor)) {
 		// UE_LOG(LogTemp, Warning, TEXT("      [X] REMOVED (Width=%.1fm triggers removal)"), SouthDoor->Width);
 	} else if (SouthDoor) {
 		FWallHoleConfig SouthDoorConfig = FWallHoleConfig::CreateCustom(
 			SouthDoor->Width, SouthDoor->Height, Width * 0.5f, Height * 0.5f, TEXT("SouthDoor"));
-		UWallUnit::CreateWallWithHole(World, SouthWallPos, SouthWallRot, 
-			Width, Height, WallThickness, SouthWallColor, SouthDoorConfig);
+		BuildWall(World, EWallSide::South, SouthWallPos, SouthWallRot, 
+			Width, Height, WallThickness, SouthWallColor, &SouthDoorConfig);
 		// UE_LOG(LogTemp, Warning, TEXT("      [O] WITH HOLE (%.1fx%.1fm doorway)"), SouthDoor->Width, SouthDoor->Height);
 	} else {
-		AActor* SouthWallActor = UWallUnit::CreateSolidWallActor(World, SouthWallPos, SouthWallRot, 
+		AActor* SouthWallActor = BuildWall(World, EWallSide::South, SouthWallPos, SouthWallRot, 
 			Width, Height, WallThickness, SouthWallColor);
 		WallActors.Add(EWallSide::South, SouthWallActor);
 		// UE_LOG(LogTemp, Warning, TEXT("      [#] SOLID (no connections)"));
@@ -635,18 +661,20 @@ void UStandardRoom::CreateRoomUsingIndividualActors(AActor* Owner)
 	FRotator NorthWallRot = FRotator(0, 180, 0);
 	FDoorConfig* NorthDoor = FindDoorConfig(EWallSide::North);
 	// UE_LOG(LogTemp, Warning, TEXT("   [N] NORTH WALL: Pos=%s, Rot=%s, Color=Red"), *NorthWallPos.ToString(), *NorthWallRot.ToString());
-	if (ShouldRemoveWall(NorthDoor)) {
+	if (IsCutLater(EWallSide::North)) {
+		// Built once from its resolved connection in BuildDeferredGeometry
+	} else if (ShouldRemoveWall(NorthDoor)) {
 		// UE_LOG(LogTemp, Warning, TEXT("      [X] REMOVED (Width=%.1fm triggers removal)"), NorthDoor->Width);
 	} else if (NorthDoor) {
 		float HoleCenterX = Width * 0.5f;
 		float HoleCenterY = Height * 0.5f;
 		FWallHoleConfig NorthDoorConfig = FWallHoleConfig::CreateCustom(
 			NorthDoor->Width, NorthDoor->Height, HoleCenterX, HoleCenterY, TEXT("NorthDoor"));
-		AActor* WallActor = UWallUnit::CreateWallWithHole(World, NorthWallPos, NorthWallRot, 
-			Width, Height, WallThickness, NorthWallColor, NorthDoorConfig);
+		BuildWall(World, EWallSide::North, NorthWallPos, NorthWallRot, 
+			Width, Height, WallThickness, NorthWallColor, &NorthDoorConfig);
 		// UE_LOG(LogTemp, Warning, TEXT("      [O] WITH HOLE (%.1fx%.1fm doorway)"), NorthDoor->Width, NorthDoor->Height);
 	} else {
-		AActor* NorthWallActor = UWallUnit::CreateSolidWallActor(World, NorthWallPos, NorthWallRot, 
+		AActor* NorthWallActor = BuildWall(World, EWallSide::North, NorthWallPos, NorthWallRot, 
 			Width, Height, WallThickness, NorthWallColor);
 		WallActors.Add(EWallSide::North, NorthWallActor);
 		// UE_LOG(LogTemp, Warning, TEXT("      [#] SOLID (no connections)"));
@@ -657,16 +685,18 @@ void UStandardRoom::CreateRoomUsingIndividualActors(AActor* Owner)
 	FRotator EastWallRot = FRotator(0, 90, 0);
 	FDoorConfig* EastDoor = FindDoorConfig(EWallSide::East);
 	// UE_LOG(LogTemp, Warning, TEXT("   [E] EAST WALL: Pos=%s, Rot=%s, Color=Blue"), *EastWallPos.ToString(), *EastWallRot.ToString());
-	if (ShouldRemoveWall(EastDoor)) {
+	if (IsCutLater(EWallSide::East)) {
+		// Built once from its resolved connection in BuildDeferredGeometry
+	} else if (ShouldRemoveWall(EastDoor)) {
 		// UE_LOG(LogTemp, Warning, TEXT("      [X] REMOVED (Width=%.1fm triggers removal)"), EastDoor->Width);
 	} else if (EastDoor) {
 		FWallHoleConfig EastDoorConfig = FWallHoleConfig::CreateCustom(
 			EastDoor->Width, EastDoor->Height, Length * 0.5f, Height * 0.5f, TEXT("EastDoor"));
-		AActor* WallActor = UWallUnit::CreateWallWithHole(World, EastWallPos, EastWallRot, 
-			Length, Height, WallThickness, EastWallColor, EastDoorConfig);
+		BuildWall(World, EWallSide::East, EastWallPos, EastWallRot, 
+			Length, Height, WallThickness, EastWallColor, &EastDoorConfig);
 		// UE_LOG(LogTemp, Warning, TEXT("      [O] WITH HOLE (%.1fx%.1fm doorway)"), EastDoor->Width, EastDoor->Height);
 	} else {
-		AActor* EastWallActor = UWallUnit::CreateSolidWallActor(World, EastWallPos, EastWallRot, 
+		AActor* EastWallActor = BuildWall(World, EWallSide::East, EastWallPos, EastWallRot, 
 			Length, Height, WallThickness, EastWallColor);
 		WallActors.Add(EWallSide::East, EastWallActor);
 		// UE_LOG(LogTemp, Warning, TEXT("      [#] SOLID (no connections)"));
@@ -677,16 +707,18 @@ void UStandardRoom::CreateRoomUsingIndividualActors(AActor* Owner)
 	FRotator WestWallRot = FRotator(0, 270, 0);
 	FDoorConfig* WestDoor = FindDoorConfig(EWallSide::West);
 	// UE_LOG(LogTemp, Warning, TEXT("   [W] WEST WALL: Pos=%s, Rot=%s, Color=Yellow"), *WestWallPos.ToString(), *WestWallRot.ToString());
-	if (ShouldRemoveWall(WestDoor)) {
+	if (IsCutLater(EWallSide::West)) {
+		// Built once from its resolved connection in BuildDeferredGeometry
+	} else if (ShouldRemoveWall(WestDoor)) {
 		// UE_LOG(LogTemp, Warning, TEXT("      [X] REMOVED (Width=%.1fm triggers removal)"), WestDoor->Width);
 	} else if (WestDoor) {
 		FWallHoleConfig WestDoorConfig = FWallHoleConfig::CreateCustom(
 			WestDoor->Width, WestDoor->Height, Length * 0.5f, Height * 0.5f, TEXT("WestDoor"));
-		AActor* WallActor = UWallUnit::CreateWallWithHole(World, WestWallPos, WestWallRot, 
-			Length, Height, WallThickness, WestWallColor, WestDoorConfig);
+		BuildWall(World, EWallSide::West, WestWallPos, WestWallRot, 
+			Length, Height, WallThickness, WestWallColor, &WestDoorConfig);
 		// UE_LOG(LogTemp, Warning, TEXT("      [O] WITH HOLE (%.1fx%.1fm doorway)"), WestDoor->Width, WestDoor->Height);
 	} else {
-		AActor* WestWallActor = UWallUnit::CreateSolidWallActor(World, WestWallPos, WestWallRot, 
+		AActor* WestWallActor = BuildWall(World, EWallSide::West, WestWallPos, WestWallRot, 
 			Length, Height, WallThickness, WestWallColor);
 		WallActors.Add(EWallSide::West, WestWallActor);
 		// UE_LOG(LogTemp, Warning, TEXT("      [#] SOLID (no connections)"));
@@ -697,7 +729,7 @@ void UStandardRoom::CreateRoomUsingIndividualActors(AActor* Owner)
 	// Floor (positioned below room center)
 	FVector FloorPos = RoomCenter + FVector(0, 0, -(HeightCm * 0.5f + WallThickness * 100.0f * 0.5f + 2.0f));
 	FRotator FloorRot = FRotator(0, 0, 90);
-	UWallUnit::CreateSolidWallActor(World, FloorPos, FloorRot, 
+	BuildWall(World, EWallSide::None, FloorPos, FloorRot, 
 		Width, Length, WallThickness, FloorColor);
 	// UE_LOG(LogTemp, Warning, TEXT("   [F] FLOOR: Pos=%s, Rot=%s, Color=Gray"), *FloorPos.ToString(), *FloorRot.ToString());
 
@@ -791,75 +823,30 @@ void UStandardRoom::AddHoleToWall(AActor* Owner, EWallSide WallSide, const FDoor
 		return;
 	}
 
-	UWorld* World = Owner->GetWorld();
-	
-	// PERFORMANCE OPTIMIZATION: Find and destroy existing wall actor
-	AActor** ExistingWallPtr = WallActors.Find(WallSide);
-	if (ExistingWallPtr && *ExistingWallPtr)
+	// Two-phase build: only the last edit per wall matters, so just remember it
+	if (bDeferWallBuild)
 	{
-		// UE_LOG(LogTemp, Warning, TEXT("🔧 AddHoleToWall: Destroying existing %s wall for replacement"), 
-			// *UEnum::GetValueAsString(WallSide));
-		(*ExistingWallPtr)->Destroy();
-		WallActors.Remove(WallSide);
+		RecordWallEdit(WallSide, DoorConfig, -1.0f, -1.0f);
+		return;
 	}
+
+	UWorld* World = Owner->GetWorld();
 	
-	// Convert from corner position (main flow) to center position (test mode)
-	FVector RoomCenter = Position + FVector(Width * 100.0f * 0.5f, Length * 100.0f * 0.5f, Height * 100.0f * 0.5f);
-	
-	// Wall dimensions in cm
-	float WidthCm = Width * 100.0f;
-	float LengthCm = Length * 100.0f;
-	float HeightCm = Height * 100.0f;
-	float WallThicknessCm = WallThickness * 100.0f;
-	float HalfThickness = WallThicknessCm * 0.5f;
-	float HalfWidthCm = WidthCm * 0.5f;
-	float HalfLengthCm = LengthCm * 0.5f;
-	float HalfHeightCm = HeightCm * 0.5f;
+	// PERFORMANCE OPTIMIZATION: Release existing wall (actor or merged mesh section)
+	// UE_LOG(LogTemp, Warning, TEXT("🔧 AddHoleToWall: Releasing existing %s wall for replacement"), 
+		// *UEnum::GetValueAsString(WallSide));
+	ReleaseWall(WallSide);
 	
-	// Calculate wall position and rotation (same logic as CreateRoomUsingIndividualActors)
+	// Wall from the room boundary outward (same placement for every cut wall)
 	FVector WallPos;
 	FRotator WallRot;
 	float WallWidth, WallHeight;
-	FLinearColor WallColor;
-	
-	switch (WallSide)
+	if (!GetOutsideWallPlacement(WallSide, WallThickness, WallPos, WallRot, WallWidth, WallHeight))
 	{
-		case EWallSide::North:
-			WallPos = RoomCenter + FVector(0, HalfLengthCm + HalfThickness, 0);
-			WallRot = FRotator(0, 0, 0);
-			WallWidth = Width;
-			WallHeight = Height;
-			WallColor = FLinearColor::Red; // North = Red (fixed)
-			break;
-			
-		case EWallSide::South:
-			WallPos = RoomCenter + FVector(0, -HalfLengthCm - HalfThickness, 0);
-			WallRot = FRotator(0, 180, 0);
-			WallWidth = Width;
-			WallHeight = Height;
-			WallColor = FLinearColor::Green; // South = Green (fixed)
-			break;
-			
-		case EWallSide::East:
-			WallPos = RoomCenter + FVector(HalfWidthCm + HalfThickness, 0, 0);
-			WallRot = FRotator(0, 90, 0);
-			WallWidth = Length;
-			WallHeight = Height;
-			WallColor = FLinearColor::Blue; // East = Blue (fixed)
-			break;
-			
-		case EWallSide::West:
-			WallPos = RoomCenter + FVector(-HalfWidthCm - HalfThickness, 0, 0);
-			WallRot = FRotator(0, 270, 0);
-			WallWidth = Length;
-			WallHeight = Height;
-			WallColor = FLinearColor::Yellow; // West = Yellow (fixed)
-			break;
-			
-		default:
-			UE_LOG(LogTemp, Error, TEXT("AddHoleToWall: Invalid WallSide %d"), (int32)WallSide);
-			return;
+		UE_LOG(LogTemp, Error, TEXT("AddHoleToWall: Invalid WallSide %d"), (int32)WallSide);
+		return;
 	}
+	const FLinearColor WallColor = GetSurfaceColor(WallSide);
 	
 	// Check if this should be a wall removal (Width >= 99.0f) or a hole
 	AActor* NewWallActor = nullptr;
@@ -920,8 +907,8 @@ void UStandardRoom::AddHoleToWall(AActor* Owner, EWallSide WallSide, const FDoor
 			// *UEnum::GetValueAsString(WallSide), DoorConfig.Width, DoorConfig.Height);
 			
 		// Create wall with hole using the same method as TestGenerator
-		NewWallActor = UWallUnit::CreateWallWithHole(World, WallPos, WallRot,
-			WallWidth, WallHeight, WallThickness, WallColor, HoleConfig);
+		NewWallActor = BuildWall(World, WallSide, WallPos, WallRot,
+			WallWidth, WallHeight, WallThickness, WallColor, &HoleConfig);
 	}
 	
 	// Store the new wall actor (or nullptr for removed walls)
@@ -936,6 +923,10 @@ void UStandardRoom::AddHoleToWall(AActor* Owner, EWallSide WallSide, const FDoor
 		// UE_LOG(LogTemp, Warning, TEXT("✅ AddHoleToWall: Successfully removed %s wall completely"), 
 		//	*UEnum::GetValueAsString(WallSide));
 	}
+	else if (MeshBatch)
+	{
+		// Queued - stored in WallActors once the batch is submitted
+	}
 	else
 	{
 		UE_LOG(LogTemp, Error, TEXT("❌ AddHoleToWall: Failed to create %s wall with hole"), 
@@ -999,73 +990,31 @@ void UStandardRoom::AddHoleToWallWithThickness(AActor* Owner, EWallSide WallSide
 		}
 	}
 	
-	// PERFORMANCE OPTIMIZATION: Find and destroy existing wall actor
-	AActor** ExistingWallPtr = WallActors.Find(WallSide);
-	if (ExistingWallPtr && *ExistingWallPtr)
+	// Two-phase build: only the last edit per wall matters, so just remember it
+	if (bDeferWallBuild)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🔧 AddHoleToWallWithThickness: Destroying existing %s wall for thick replacement"), 
-			*UEnum::GetValueAsString(WallSide));
-		(*ExistingWallPtr)->Destroy();
-		WallActors.Remove(WallSide);
+		RecordWallEdit(WallSide, DoorConfig, CustomThickness, SmallerWallSize);
+		return;
 	}
 	
-	// Convert from corner position (main flow) to center position (test mode)
-	FVector RoomCenter = Position + FVector(Width * 100.0f * 0.5f, Length * 100.0f * 0.5f, Height * 100.0f * 0.5f);
-	
-	// Wall dimensions in cm
-	float WidthCm = Width * 100.0f;
-	float LengthCm = Length * 100.0f;
-	float HeightCm = Height * 100.0f;
-	float WallThicknessCm = CustomThickness * 100.0f; // Use custom thickness
-	float HalfThickness = WallThicknessCm * 0.5f;
-	float HalfWidthCm = WidthCm * 0.5f;
-	float HalfLengthCm = LengthCm * 0.5f;
-	float HalfHeightCm = HeightCm * 0.5f;
+	// PERFORMANCE OPTIMIZATION: Release existing wall (actor or merged mesh section)
+	if (WallActors.Contains(WallSide))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("🔧 AddHoleToWallWithThickness: Releasing existing %s wall for thick replacement"), 
+			*UEnum::GetValueAsString(WallSide));
+	}
+	ReleaseWall(WallSide);
 	
-	// Calculate wall position and rotation (same logic as CreateRoomUsingIndividualActors)
+	// Wall from the room boundary outward (same placement for every cut wall)
 	FVector WallPos;
 	FRotator WallRot;
 	float WallWidth, WallHeight;
-	FLinearColor WallColor;
-	
-	switch (WallSide)
+	if (!GetOutsideWallPlacement(WallSide, CustomThickness, WallPos, WallRot, WallWidth, WallHeight))
 	{
-		case EWallSide::North:
-			WallPos = RoomCenter + FVector(0, HalfLengthCm + HalfThickness, 0);
-			WallRot = FRotator(0, 0, 0);
-			WallWidth = Width;
-			WallHeight = Height;
-			WallColor = FLinearColor::Red; // North = Red (fixed)
-			break;
-			
-		case EWallSide::South:
-			WallPos = RoomCenter + FVector(0, -HalfLengthCm - HalfThickness, 0);
-			WallRot = FRotator(0, 180, 0);
-			WallWidth = Width;
-			WallHeight = Height;
-			WallColor = FLinearColor::Green; // South = Green (fixed)
-			break;
-			
-		case EWallSide::East:
-			WallPos = RoomCenter + FVector(HalfWidthCm + HalfThickness, 0, 0);
-			WallRot = FRotator(0, 90, 0);
-			WallWidth = Length;
-			WallHeight = Height;
-			WallColor = FLinearColor::Blue; // East = Blue (fixed)
-			break;
-			
-		case EWallSide::West:
-			WallPos = RoomCenter + FVector(-HalfWidthCm - HalfThickness, 0, 0);
-			WallRot = FRotator(0, 270, 0);
-			WallWidth = Length;
-			WallHeight = Height;
-			WallColor = FLinearColor::Yellow; // West = Yellow (fixed)
-			break;
-			
-		default:
-			UE_LOG(LogTemp, Error, TEXT("AddHoleToWallWithThickness: Invalid WallSide %d"), (int32)WallSide);
-			return;
+		UE_LOG(LogTemp, Error, TEXT("AddHoleToWallWithThickness: Invalid WallSide %d"), (int32)WallSide);
+		return;
 	}
+	const FLinearColor WallColor = GetSurfaceColor(WallSide);
 	
 	// Calculate hole position - respect OffsetFromCenter parameter for alignment
 	// BOUNDARY FIX: Use SmallerWallSize if provided to constrain random positioning within connection bounds
@@ -1146,8 +1095,8 @@ void UStandardRoom::AddHoleToWallWithThickness(AActor* Owner, EWallSide WallSide
 		// *UEnum::GetValueAsString(WallSide), DoorConfig.Width, DoorConfig.Height, CustomThickness);
 		
 	// Create wall with hole using custom thickness
-	AActor* NewWallActor = UWallUnit::CreateWallWithHole(World, WallPos, WallRot,
-		WallWidth, WallHeight, CustomThickness, WallColor, HoleConfig);
+	AActor* NewWallActor = BuildWall(World, WallSide, WallPos, WallRot,
+		WallWidth, WallHeight, CustomThickness, WallColor, &HoleConfig);
 	
 	// Store the new wall actor
 	if (NewWallActor)
@@ -1156,6 +1105,10 @@ void UStandardRoom::AddHoleToWallWithThickness(AActor* Owner, EWallSide WallSide
 		UE_LOG(LogTemp, Warning, TEXT("✅ AddHoleToWallWithThickness: Successfully created thick %s wall with hole"), 
 			*UEnum::GetValueAsString(WallSide));
 	}
+	else if (MeshBatch)
+	{
+		// Queued - stored in WallActors once the batch is submitted
+	}
 	else
 	{
 		UE_LOG(LogTemp, Error, TEXT("❌ AddHoleToWallWithThickness: Failed to create thick %s wall with hole"), 
@@ -1163,6 +1116,479 @@ void UStandardRoom::AddHoleToWallWithThickness(AActor* Owner, EWallSide WallSide
 	}
 }
 
+void UStandardRoom::RecordWallEdit(EWallSide WallSide, const FDoorConfig& DoorConfig, float CustomThickness, float SmallerWallSize)
+{
+	FPendingWallEdit& Edit = PendingWallEdits.FindOrAdd(WallSide);
+	Edit.DoorConfig = DoorConfig;
+	Edit.CustomThickness = CustomThickness;
+	Edit.SmallerWallSize = SmallerWallSize;
+	NumRecordedWallEdits++;
+}
+
+int32 UStandardRoom::BuildDeferredGeometry(AActor* Owner)
+{
+	if (!bDeferWallBuild)
+	{
+		return 0;
+	}
+	bDeferWallBuild = false;
+
+	// Untouched walls and the floor first, then every cut wall exactly once with its final opening
+	if (bGeometryPending)
+	{
+		bGeometryPending = false;
+		CreateRoomUsingIndividualActors(Owner);
+	}
+
+	const TMap<EWallSide, FPendingWallEdit> Edits = MoveTemp(PendingWallEdits);
+	PendingWallEdits.Reset();
+
+	// Seams shared with a neighbour: owned ones are built here, dropped ones not at all
+	const TMap<EWallSide, FSharedWall> Seams = MoveTemp(SharedWalls);
+	SharedWalls.Reset();
+	for (const TPair<EWallSide, FSharedWall>& Seam : Seams)
+	{
+		if (Seam.Value.bOwner)
+		{
+			BuildSharedWall(Owner->GetWorld(), Seam.Key, Seam.Value, Edits.Find(Seam.Key));
+		}
+	}
+
+	for (const TPair<EWallSide, FPendingWallEdit>& Edit : Edits)
+	{
+		if (Seams.Contains(Edit.Key))
+		{
+			continue;
+		}
+		if (Edit.Value.CustomThickness > 0.0f)
+		{
+			AddHoleToWallWithThickness(Owner, Edit.Key, Edit.Value.DoorConfig, Edit.Value.CustomThickness, Edit.Value.SmallerWallSize);
+		}
+		else
+		{
+			AddHoleToWall(Owner, Edit.Key, Edit.Value.DoorConfig);
+		}
+	}
+
+	// Edits that never reached geometry because a later one replaced them
+	const int32 CollapsedEdits = NumRecordedWallEdits - Edits.Num();
+	NumRecordedWallEdits = 0;
+	return CollapsedEdits;
+}
+
+bool UStandardRoom::CanShareWall(EWallSide WallSide, FDoorConfig& OutOpening, bool& bOutHasOpening) const
+{
+	bOutHasOpening = false;
+	if (!bDeferWallBuild || SharedWalls.Contains(WallSide))
+	{
+		return false;
+	}
+
+	// Doors configured up front are built by CreateRoomUsingIndividualActors itself
+	for (const FDoorConfig& Config : DoorConfigs)
+	{
+		if (Config.bHasDoor && Config.WallSide == WallSide)
+		{
+			return false;
+		}
+	}
+
+	if (const FPendingWallEdit* Edit = PendingWallEdits.Find(WallSide))
+	{
+		if (Edit->CustomThickness > 0.0f || Edit->DoorConfig.Width >= 99.0f)
+		{
+			return false; // Thick or removed walls keep their own build
+		}
+		OutOpening = Edit->DoorConfig;
+		bOutHasOpening = true;
+	}
+	return true;
+}
+
+void UStandardRoom::DropSharedWall(EWallSide WallSide)
+{
+	SharedWalls.Add(WallSide, FSharedWall());
+}
+
+void UStandardRoom::OwnSharedWall(EWallSide WallSide, float SeamThickness, const FDoorConfig* NeighbourOpening, const FVector& NeighbourOpeningCenter)
+{
+	FSharedWall& Seam = SharedWalls.Add(WallSide);
+	Seam.bOwner = true;
+	Seam.SeamThickness = SeamThickness;
+	Seam.bHasNeighbourOpening = (NeighbourOpening != nullptr);
+	if (NeighbourOpening)
+	{
+		Seam.NeighbourOpening = *NeighbourOpening;
+		Seam.NeighbourOpeningCenter = NeighbourOpeningCenter;
+	}
+}
+
+void UStandardRoom::BuildSharedWall(UWorld* World, EWallSide WallSide, const FSharedWall& Seam, const FPendingWallEdit* OwnEdit)
+{
+	FVector WallPos;
+	FRotator WallRot;
+	float WallWidth, WallHeight;
+	if (!World || !GetOutsideWallPlacement(WallSide, Seam.SeamThickness, WallPos, WallRot, WallWidth, WallHeight))
+	{
+		return;
+	}
+
+	// The neighbour's opening goes where the neighbour's wall was, our own opening stays centered (as in AddHoleToWall)
+	TOptional<FWallHoleConfig> HoleConfig;
+	const FDoorConfig* Opening = Seam.bHasNeighbourOpening ? &Seam.NeighbourOpening : (OwnEdit ? &OwnEdit->DoorConfig : nullptr);
+	if (Opening)
+	{
+		float HolePositionX = WallWidth * 0.5f;
+		if (Seam.bHasNeighbourOpening)
+		{
+			// Hole X is measured from the wall's local -X edge
+			const FVector WallAxis = WallRot.RotateVector(FVector::ForwardVector);
+			HolePositionX += FVector::DotProduct(Seam.NeighbourOpeningCenter - WallPos, WallAxis) / 100.0f;
+		}
+		HolePositionX = FMath::Clamp(HolePositionX, Opening->Width * 0.5f, FMath::Max(WallWidth - Opening->Width * 0.5f, Opening->Width * 0.5f));
+
+		HoleConfig = FWallHoleConfig::CreateCustom(
+			Opening->Width, Opening->Height,
+			HolePositionX, Opening->Height * 0.5f, // Bottom-aligned like every connection hole
+			FString::Printf(TEXT("%sSharedWallHole"), *UEnum::GetValueAsString(WallSide))
+		);
+		HoleConfig->Shape = EHoleShape::Rectangle;
+	}
+
+	AActor* NewWallActor = BuildWall(World, WallSide, WallPos, WallRot,
+		WallWidth, WallHeight, Seam.SeamThickness, GetSurfaceColor(WallSide), HoleConfig.GetPtrOrNull());
+	if (NewWallActor)
+	{
+		WallActors.Add(WallSide, NewWallActor);
+	}
+}
+
+AActor* UStandardRoom::BuildWall(UWorld* World, EWallSide WallSide, const FVector& WallPos, const FRotator& WallRot,
+	float WallWidth, float WallHeight, float Thickness, const FLinearColor& Color, const FWallHoleConfig* HoleConfig)
+{
+	if (!HoleConfig && InstancedWalls)
+	{
+		// Solid box: one more instance of the shared unit-box mesh, no geometry is built
+		const int32 Handle = InstancedWalls->AddWall(WallPos, WallRot, WallWidth, WallHeight, Thickness, Color);
+		if (Handle != INDEX_NONE)
+		{
+			InstancedWallHandles.Add(WallSide, Handle);
+			return InstancedWalls->GetHostActor();
+		}
+	}
+
+	if (MeshBatch)
+	{
+		// Batched mode: compile the hole now (it draws random numbers), the mesh is built later on a worker thread
+		TOptional<FResolvedHole> Hole;
+		if (HoleConfig)
+		{
+			Hole = FResolvedHole::Compile(*HoleConfig, WallWidth, WallHeight);
+		}
+		TWeakObjectPtr<UStandardRoom> WeakRoom(this);
+		TWeakObjectPtr<UWorld> WeakWorld(World);
+		MeshBatch->QueueWall(this, GetMergedSectionIndex(WallSide), WallPos, WallRot, WallWidth, WallHeight, Thickness, Hole.GetPtrOrNull(),
+			[WeakRoom, WeakWorld, WallSide, WallPos, Color, Hole](TArray<FVector>&& WallVertices, TArray<int32>&& WallTriangles,
+				TArray<FVector>&& WallNormals, TArray<FVector2D>&& WallUVs, TArray<TArray<FVector>>&& CollisionHulls)
+			{
+				UStandardRoom* Room = WeakRoom.Get();
+				UWorld* SubmitWorld = WeakWorld.Get();
+				if (!Room || !SubmitWorld)
+				{
+					return;
+				}
+				UWallUnit::DrawPlacementDebugSphere(SubmitWorld, WallPos, Hole.GetPtrOrNull());
+				AActor* WallActor = Room->SubmitWallMesh(SubmitWorld, WallSide, Color,
+					MoveTemp(WallVertices), MoveTemp(WallTriangles), MoveTemp(WallNormals), MoveTemp(WallUVs), MoveTemp(CollisionHulls));
+				if (WallActor && WallSide != EWallSide::None)
+				{
+					Room->WallActors.Add(WallSide, WallActor);
+				}
+			});
+		return nullptr;
+	}
+
+	TArray<FVector> WallVertices;
+	TArray<int32> WallTriangles;
+	TArray<FVector> WallNormals;
+	TArray<FVector2D> WallUVs;
+	TArray<TArray<FVector>> CollisionHulls;
+	UWallUnit::GenerateWallMesh(WallVertices, WallTriangles, WallNormals, WallUVs,
+		WallPos, WallRot, WallWidth, WallHeight, Thickness, HoleConfig, World, &CollisionHulls);
+
+	return SubmitWallMesh(World, WallSide, Color,
+		MoveTemp(WallVertices), MoveTemp(WallTriangles), MoveTemp(WallNormals), MoveTemp(WallUVs), MoveTemp(CollisionHulls));
+}
+
+AActor* UStandardRoom::SubmitWallMesh(UWorld* World, EWallSide WallSide, const FLinearColor& Color,
+	TArray<FVector>&& WallVertices, TArray<int32>&& WallTriangles, TArray<FVector>&& WallNormals, TArray<FVector2D>&& WallUVs,
+	TArray<TArray<FVector>>&& CollisionHulls)
+{
+	// No hulls means the visual mesh is cooked as complex collision
+	if (!bSimpleWallCollision)
+	{
+		CollisionHulls.Reset();
+	}
+
+	const FVector RoomCenter = Position + FVector(Width * 100.0f * 0.5f, Length * 100.0f * 0.5f, Height * 100.0f * 0.5f);
+
+	AActor* SubmittedActor = nullptr;
+	if (ChunkBuilder)
+	{
+		// Chunk mode: hand world-space geometry to the chunk, it is concatenated on the next rebuild
+		SubmittedActor = ChunkBuilder->SetSurfaceGeometry(this, GetMergedSectionIndex(WallSide), RoomCenter,
+			MoveTemp(WallVertices), MoveTemp(WallTriangles), MoveTemp(WallNormals), MoveTemp(WallUVs), Color, MoveTemp(CollisionHulls));
+	}
+	else if (bMergeRoomMesh)
+	{
+		// Merged mode: (re)build this wall's section on the shared room actor
+		if (!IsValid(MergedRoomActor))
+		{
+			MergedRoomActor = UWallUnit::CreateMergedMeshActor(World, RoomCenter, bAsyncCollisionCooking);
+		}
+		const bool bSimpleCollision = CollisionHulls.Num() > 0;
+		const bool bBuilt = UWallUnit::SetWallSectionFromMesh(MergedRoomActor, GetMergedSectionIndex(WallSide),
+			MoveTemp(WallVertices), WallTriangles, WallNormals, WallUVs, Color, !bSimpleCollision);
+		if (bBuilt && bSimpleCollision)
+		{
+			MergedSectionHulls.Add(GetMergedSectionIndex(WallSide), MoveTemp(CollisionHulls));
+			UpdateMergedCollision();
+		}
+		SubmittedActor = bBuilt ? MergedRoomActor : nullptr;
+	}
+	else
+	{
+		// Individual mode: one actor per wall (TestGenerator layout), taken from the pool when there is one
+		SubmittedActor = WallPool ? WallPool->Acquire(World, bAsyncCollisionCooking) : UWallUnit::SpawnWallActor(World, bAsyncCollisionCooking);
+		if (!UWallUnit::SetWallActorMesh(SubmittedActor, WallVertices, WallTriangles, WallNormals, WallUVs, Color, &CollisionHulls))
+		{
+			SubmittedActor = nullptr;
+		}
+		if (WallSide == EWallSide::None)
+		{
+			FloorActor = SubmittedActor;
+		}
+	}
+
+	WatchCollisionCook(SubmittedActor);
+	return SubmittedActor;
+}
+
+void UStandardRoom::WatchCollisionCook(AActor* WallActor)
+{
+	if (!CookTracker || !WallActor)
+	{
+		return;
+	}
+
+	// Chunk actors are only rebuilt later - the watch then covers the cook of that rebuild
+	if (UProceduralMeshComponent* WallMesh = Cast<UProceduralMeshComponent>(WallActor->GetRootComponent()))
+	{
+		CookTracker->WatchComponent(this, WallMesh);
+	}
+}
+
+void UStandardRoom::UpdateMergedCollision()
+{
+	TArray<TArray<FVector>> RoomHulls;
+	for (const TPair<int32, TArray<TArray<FVector>>>& Section : MergedSectionHulls)
+	{
+		RoomHulls.Append(Section.Value);
+	}
+	UWallUnit::SetSimpleCollision(MergedRoomActor, RoomHulls);
+}
+
+void UStandardRoom::ReleaseWall(EWallSide WallSide)
+{
+	int32 InstanceHandle;
+	if (InstancedWalls && InstancedWallHandles.RemoveAndCopyValue(WallSide, InstanceHandle))
+	{
+		// Instanced solid wall - the host actor is shared, only the instance goes away
+		InstancedWalls->RemoveWall(InstanceHandle);
+		WallActors.Remove(WallSide);
+		return;
+	}
+
+	if (MeshBatch && MeshBatch->CancelWall(this, GetMergedSectionIndex(WallSide)))
+	{
+		// Still queued - nothing has been built for this wall yet
+		WallActors.Remove(WallSide);
+		return;
+	}
+
+	if (ChunkBuilder)
+	{
+		ChunkBuilder->RemoveSurfaceGeometry(this, GetMergedSectionIndex(WallSide));
+		WallActors.Remove(WallSide);
+		return;
+	}
+
+	if (bMergeRoomMesh)
+	{
+		// Only the section goes away - the room actor is shared by every wall
+		UWallUnit::ClearWallSection(MergedRoomActor, GetMergedSectionIndex(WallSide));
+		if (MergedSectionHulls.Remove(GetMergedSectionIndex(WallSide)) > 0)
+		{
+			UpdateMergedCollision();
+		}
+		WallActors.Remove(WallSide);
+		return;
+	}
+
+	AActor** ExistingWallPtr = WallActors.Find(WallSide);
+	if (ExistingWallPtr && *ExistingWallPtr)
+	{
+		// Pooled: the rebuilt wall takes this actor straight back and replaces its mesh in place
+		if (WallPool)
+		{
+			WallPool->Release(*ExistingWallPtr);
+		}
+		else
+		{
+			(*ExistingWallPtr)->Destroy();
+		}
+	}
+	WallActors.Remove(WallSide);
+}
+
+bool UStandardRoom::GetOutsideWallPlacement(EWallSide WallSide, float Thickness, FVector& OutPos, FRotator& OutRot,
+	float& OutWallWidth, float& OutWallHeight) const
+{
+	const FVector RoomCenter = Position + FVector(Width * 100.0f * 0.5f, Length * 100.0f * 0.5f, Height * 100.0f * 0.5f);
+	const float HalfThickness = Thickness * 100.0f * 0.5f;
+	const float HalfWidthCm = Width * 100.0f * 0.5f;
+	const float HalfLengthCm = Length * 100.0f * 0.5f;
+	OutWallHeight = Height;
+	
+	switch (WallSide)
+	{
+		case EWallSide::North:
+			OutPos = RoomCenter + FVector(0, HalfLengthCm + HalfThickness, 0);
+			OutRot = FRotator(0, 0, 0);
+			OutWallWidth = Width;
+			return true;
+		case EWallSide::South:
+			OutPos = RoomCenter + FVector(0, -HalfLengthCm - HalfThickness, 0);
+			OutRot = FRotator(0, 180, 0);
+			OutWallWidth = Width;
+			return true;
+		case EWallSide::East:
+			OutPos = RoomCenter + FVector(HalfWidthCm + HalfThickness, 0, 0);
+			OutRot = FRotator(0, 90, 0);
+			OutWallWidth = Length;
+			return true;
+		case EWallSide::West:
+			OutPos = RoomCenter + FVector(-HalfWidthCm - HalfThickness, 0, 0);
+			OutRot = FRotator(0, 270, 0);
+			OutWallWidth = Length;
+			return true;
+		default:
+			return false;
+	}
+}
+
+FLinearColor UStandardRoom::GetSurfaceColor(EWallSide WallSide)
+{
+	switch (WallSide)
+	{
+		case EWallSide::South: return FLinearColor::Green;   // South wall = Green
+		case EWallSide::North: return FLinearColor::Red;     // North wall = Red
+		case EWallSide::East:  return FLinearColor::Blue;    // East wall = Blue
+		case EWallSide::West:  return FLinearColor::Yellow;  // West wall = Yellow
+		default:               return FLinearColor::Gray;    // Floor = Gray
+	}
+}
+
+void UStandardRoom::GetDetailActors(TArray<AActor*>& OutActors) const
+{
+	// Only actors this room owns alone - chunk and instance host actors are shared between rooms
+	if (ChunkBuilder)
+	{
+		return;
+	}
+	const AActor* InstanceHost = InstancedWalls ? InstancedWalls->GetHostActor() : nullptr;
+	auto AddActor = [&OutActors, InstanceHost](AActor* Actor)
+	{
+		if (IsValid(Actor) && Actor != InstanceHost)
+		{
+			OutActors.AddUnique(Actor);
+		}
+	};
+
+	for (const TPair<EWallSide, AActor*>& Wall : WallActors)
+	{
+		AddActor(Wall.Value);
+	}
+	AddActor(FloorActor);
+	AddActor(MergedRoomActor);
+}
+
+AActor* UStandardRoom::CreateLodProxyActor(UWorld* World) const
+{
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// Same layout as CreateRoomUsingIndividualActors, one quad per surface on its mid-plane
+	// Walls stand outside the room boundary (GetOutsideWallPlacement), so their quads are pushed out by half the
+	// thickness and widened by it so the corners close
+	const float WallThicknessCm = WallThickness * 100.0f;
+	const float HalfWidth = Width * 0.5f * 100.0f;
+	const float HalfLength = Length * 0.5f * 100.0f;
+	const float HalfHeight = Height * 0.5f * 100.0f;
+	const FVector RoomCenter = Position + FVector(HalfWidth, HalfLength, HalfHeight);
+
+	AActor* ProxyActor = UWallUnit::CreateMergedMeshActor(World, RoomCenter);
+	UProceduralMeshComponent* ProxyMesh = ProxyActor ? Cast<UProceduralMeshComponent>(ProxyActor->GetRootComponent()) : nullptr;
+	if (!ProxyMesh)
+	{
+		return ProxyActor;
+	}
+	// Visual only - the full-detail actors keep colliding while the proxy is shown
+	ProxyMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ProxyMesh->SetCastShadow(false);
+
+	// Quad facing Normal, spanning +-AxisU and +-AxisV around Center (openings are simply covered)
+	auto AddQuad = [&](EWallSide Side, const FVector& Center, FVector AxisU, FVector AxisV, const FVector& Normal)
+	{
+		if (FVector::DotProduct(FVector::CrossProduct(AxisU, AxisV), Normal) < 0.0f)
+		{
+			Swap(AxisU, AxisV);
+		}
+		TArray<FVector> Vertices = { Center - AxisU - AxisV, Center + AxisU - AxisV, Center + AxisU + AxisV, Center - AxisU + AxisV };
+		const TArray<int32> Triangles = { 0, 1, 2, 0, 2, 3 };
+		const TArray<FVector> Normals = { Normal, Normal, Normal, Normal };
+		const TArray<FVector2D> UVs = { FVector2D(0, 0), FVector2D(1, 0), FVector2D(1, 1), FVector2D(0, 1) };
+		UWallUnit::SetWallSectionFromMesh(ProxyActor, GetMergedSectionIndex(Side), MoveTemp(Vertices), Triangles, Normals, UVs,
+			GetSurfaceColor(Side), false);
+	};
+
+	const float HalfThickness = WallThicknessCm * 0.5f;
+	const FVector HalfX(HalfWidth, 0, 0);
+	const FVector HalfY(0, HalfLength, 0);
+	const FVector HalfZ(0, 0, HalfHeight);
+	const FVector WallOffsetX(HalfWidth + HalfThickness, 0, 0);
+	const FVector WallOffsetY(0, HalfLength + HalfThickness, 0);
+	const FVector WallSpanX(HalfWidth + WallThicknessCm, 0, 0);
+	const FVector WallSpanY(0, HalfLength + WallThicknessCm, 0);
+	AddQuad(EWallSide::South, RoomCenter - WallOffsetY, WallSpanX, HalfZ, FVector(0, -1, 0));
+	AddQuad(EWallSide::North, RoomCenter + WallOffsetY, WallSpanX, HalfZ, FVector(0, 1, 0));
+	AddQuad(EWallSide::East, RoomCenter + WallOffsetX, WallSpanY, HalfZ, FVector(1, 0, 0));
+	AddQuad(EWallSide::West, RoomCenter - WallOffsetX, WallSpanY, HalfZ, FVector(-1, 0, 0));
+	const FVector FloorCenter = RoomCenter - FVector(0, 0, HalfHeight + WallThicknessCm * 0.5f + 2.0f);
+	AddQuad(EWallSide::None, FloorCenter, HalfX, HalfY, FVector(0, 0, 1));
+
+	ProxyActor->SetActorHiddenInGame(true);
+	return ProxyActor;
+}
+
+int32 UStandardRoom::GetMergedSectionIndex(EWallSide WallSide)
+{
+	// Section 0 is the floor (EWallSide::None), walls use their enum value (1-4)
+	return static_cast<int32>(WallSide);
+}
+
 void UStandardRoom::CreateRoomNumberText(int32 RoomIndex, bool bShowNumbers)
 {
 	// Skip creation if disabled
@@ -1186,6 +1612,14 @@ void UStandardRoom::CreateRoomNumberText(int32 RoomIndex, bool bShowNumbers)
 		return;
 	}
 	
+	// Batched: a few more digit bar instances on the shared label component, no actor
+	UBillboardLabelSubsystem* LabelSubsystem = World->GetSubsystem<UBillboardLabelSubsystem>();
+	if (bBatchRoomNumbers && LabelSubsystem)
+	{
+		LabelSubsystem->AddNumberLabel(NumberPosition, RoomIndex + 1, 200.0f);
+		return;
+	}
+	
 	// Spawn the custom billboard text actor
 	ABillboardTextActor* BillboardActor = World->SpawnActor<ABillboardTextActor>(NumberPosition, FRotator::ZeroRotator);
 	if (!IsValid(BillboardActor))
@@ -1200,7 +1634,7 @@ void UStandardRoom::CreateRoomNumberText(int32 RoomIndex, bool bShowNumbers)
 	BillboardActor->SetTextSize(200.0f); // Big size for visibility
 	BillboardActor->SetTextColor(FColor::White); // White for contrast
 	
-	UE_LOG(LogTemp, Log, TEXT("✅ Created billboard room number label: %s at %s (updates every 2s)"), *RoomNumberText, *NumberPosition.ToString());
+	UE_LOG(LogTemp, Log, TEXT("✅ Created billboard room number label: %s at %s (turned by the label subsystem)"), *RoomNumberText, *NumberPosition.ToString());
 }
 
 void UStandardRoom::CreateHallwayDebugSphere(AActor* Owner)
@@ -1217,6 +1651,13 @@ void UStandardRoom::CreateHallwayDebugSphere(AActor* Owner)
 	FVector RoomCenter = Position + FVector(Width * 100.0f * 0.5f, Length * 100.0f * 0.5f, Height * 100.0f * 0.5f);
 	FVector SpherePosition = RoomCenter + FVector(0, 0, 300.0f); // 3m above hallway center
 	
+	// Shared overlay: one more instance, no actor
+	if (DebugMarkers)
+	{
+		DebugMarkers->AddMarker(SpherePosition, 200.0f, FLinearColor(1.0f, 0.0f, 1.0f, 1.0f));
+		return;
+	}
+	
 	// Create static mesh actor for the sphere
 	AStaticMeshActor* SphereActor = World->SpawnActor<AStaticMeshActor>(SpherePosition, FRotator::ZeroRotator);
 	if (!IsValid(SphereActor))
@@ -1241,18 +1682,8 @@ void UStandardRoom::CreateHallwayDebugSphere(AActor* Owner)
 		MeshComponent->SetStaticMesh(SphereMesh);
 		MeshComponent->SetWorldScale3D(FVector(2.0f)); // 2x scale for visibility
 		
-		// Create purple material
-		UMaterialInterface* PurpleMaterial = LoadObject<UMaterialInterface>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial"));
-		if (PurpleMaterial)
-		{
-			// Create dynamic material instance to set purple color
-			UMaterialInstanceDynamic* DynamicMaterial = UMaterialInstanceDynamic::Create(PurpleMaterial, MeshComponent);
-			if (DynamicMaterial)
-			{
-				DynamicMaterial->SetVectorParameterValue("Color", FLinearColor(1.0f, 0.0f, 1.0f, 1.0f)); // Purple
-				MeshComponent->SetMaterial(0, DynamicMaterial);
-			}
-		}
+		// Shared purple material
+		MeshComponent->SetMaterial(0, UWallMaterialCache::GetColorMaterial(FLinearColor(1.0f, 0.0f, 1.0f, 1.0f)));
 		
 		// Make it glow/bright
 		MeshComponent->SetCastShadow(false);
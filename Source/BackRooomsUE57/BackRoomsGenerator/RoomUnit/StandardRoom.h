@@ -9,6 +9,13 @@
 #include "BaseRoom.h"
 #include "StandardRoom.generated.h"
 
+class IChunkMeshBuilder;
+class IInstancedWallRenderer;
+class IRoomMeshBatchBuilder;
+class ICollisionCookTracker;
+class IWallActorPool;
+class IDebugMarkerOverlay;
+
 UCLASS(BlueprintType)
 class UStandardRoom : public UBaseRoom
 {
@@ -21,6 +28,53 @@ public:
 	UPROPERTY()
 	TMap<EWallSide, AActor*> WallActors;
 
+	// Room build mode: emit all walls and the floor as sections of one mesh actor
+	UPROPERTY()
+	bool bMergeRoomMesh = false;
+
+	// Shared room actor used when bMergeRoomMesh is set (one section per wall + floor)
+	UPROPERTY()
+	AActor* MergedRoomActor = nullptr;
+
+	// Floor actor in individual build mode (walls are tracked in WallActors)
+	UPROPERTY()
+	AActor* FloorActor = nullptr;
+
+	// Walls and floor collide as simple boxes instead of cooking their visual mesh as complex collision
+	UPROPERTY()
+	bool bSimpleWallCollision = false;
+
+	// Wall, room and chunk mesh components cook their collision off the game thread
+	UPROPERTY()
+	bool bAsyncCollisionCooking = false;
+
+	// Chunk build mode: surfaces go to a shared spatial chunk mesh (takes precedence over bMergeRoomMesh)
+	// Owned by the generator; the caller rebuilds dirty chunks after changing rooms
+	IChunkMeshBuilder* ChunkBuilder = nullptr;
+
+	// Instanced solid walls: walls without holes and the floor become unit-box instances
+	// Owned by the generator; only holed walls go through procedural geometry
+	IInstancedWallRenderer* InstancedWalls = nullptr;
+
+	// Batched build: procedural walls are queued and built for many rooms at once on worker threads
+	// Owned by the generator; WallActors is filled in when the caller submits the batch
+	IRoomMeshBatchBuilder* MeshBatch = nullptr;
+
+	// Collision cook tracking: every component a surface is submitted to is watched for this room
+	// Owned by the generator, which reports the room walkable once its cooks have finished
+	ICollisionCookTracker* CookTracker = nullptr;
+
+	// Individual mode: released wall actors are parked here and reused instead of destroyed and respawned
+	// Owned by the generator and shared by every room (null = spawn and destroy walls directly)
+	IWallActorPool* WallPool = nullptr;
+
+	// Debug spheres become instances of the generator's shared marker overlay (null = spawn a sphere actor)
+	IDebugMarkerOverlay* DebugMarkers = nullptr;
+
+	// Room number as instanced digit bars of the world's label subsystem instead of a text actor per room
+	UPROPERTY()
+	bool bBatchRoomNumbers = false;
+
 	// StandardRoom-specific methods
 	
 	// Individual actor creation (same as test mode)
@@ -32,6 +86,31 @@ public:
 	
 	// Unified room creation from RoomData with automatic numbering
 	bool CreateFromRoomData(const FRoomData& RoomData, AActor* Owner, bool bShowNumbers = true);
+
+	// Two-phase build: while set, walls are not built - connection cuts only record the final opening per wall
+	// BuildDeferredGeometry then builds every wall once (solid, cut or removed) and clears the flag
+	UPROPERTY()
+	bool bDeferWallBuild = false;
+
+	// Build the deferred walls and floor; returns how many recorded edits were superseded and never built
+	int32 BuildDeferredGeometry(AActor* Owner);
+
+	// Shared walls (two-phase build only): a seam between two adjacent rooms is built once, by the room that owns it
+	// A wall can be shared while its final edit is at most a plain opening (not removed, not thickened)
+	bool CanShareWall(EWallSide WallSide, FDoorConfig& OutOpening, bool& bOutHasOpening) const;
+	// The neighbour owns this seam - the wall and its recorded edit are not built
+	void DropSharedWall(EWallSide WallSide);
+	// This room builds the seam: one wall SeamThickness (m) thick from the boundary outward, filling the gap to the neighbour
+	// NeighbourOpening is cut centered on NeighbourOpeningCenter (world); otherwise this wall's own recorded opening is used
+	void OwnSharedWall(EWallSide WallSide, float SeamThickness, const FDoorConfig* NeighbourOpening, const FVector& NeighbourOpeningCenter);
+
+	// LOD: actors drawn only by this room (not chunk or instance hosts) and a hidden box-shell proxy
+	// The proxy is one quad per wall and the floor - openings are covered, no collision
+	virtual void GetDetailActors(TArray<AActor*>& OutActors) const;
+	AActor* CreateLodProxyActor(UWorld* World) const;
+
+	// Debug color of a wall side (EWallSide::None = floor)
+	static FLinearColor GetSurfaceColor(EWallSide WallSide);
 	
 
 protected:
@@ -53,6 +132,54 @@ private:
 	void GenerateIndividualWalls(TArray<TArray<FVector>>& WallVertices, TArray<TArray<int32>>& WallTriangles, 
 		TArray<TArray<FVector>>& WallNormals, TArray<TArray<FVector2D>>& WallUVs);
 
+	// Placement of a wall that starts at the room boundary and extends Thickness (m) outward - used for every cut wall
+	bool GetOutsideWallPlacement(EWallSide WallSide, float Thickness, FVector& OutPos, FRotator& OutRot,
+		float& OutWallWidth, float& OutWallHeight) const;
+
+	// Wall emission - routes to an individual actor, a section of MergedRoomActor or a chunk mesh
+	// EWallSide::None builds the floor
+	AActor* BuildWall(UWorld* World, EWallSide WallSide, const FVector& WallPos, const FRotator& WallRot,
+		float WallWidth, float WallHeight, float Thickness, const FLinearColor& Color, const FWallHoleConfig* HoleConfig = nullptr);
+	void ReleaseWall(EWallSide WallSide);
+	// Hand a built world-space wall mesh to the chunk builder, the merged room actor or a new wall actor
+	AActor* SubmitWallMesh(UWorld* World, EWallSide WallSide, const FLinearColor& Color,
+		TArray<FVector>&& WallVertices, TArray<int32>&& WallTriangles, TArray<FVector>&& WallNormals, TArray<FVector2D>&& WallUVs,
+		TArray<TArray<FVector>>&& CollisionHulls);
+	// Let CookTracker wait for the collision cook just queued on a submitted wall's component
+	void WatchCollisionCook(AActor* WallActor);
+	static int32 GetMergedSectionIndex(EWallSide WallSide);
+
+	// Final connection edit per wall while bDeferWallBuild is set (CustomThickness <= 0 = AddHoleToWall)
+	struct FPendingWallEdit
+	{
+		FDoorConfig DoorConfig;
+		float CustomThickness = -1.0f;
+		float SmallerWallSize = -1.0f;
+	};
+	TMap<EWallSide, FPendingWallEdit> PendingWallEdits;
+	int32 NumRecordedWallEdits = 0;
+	bool bGeometryPending = false;
+	void RecordWallEdit(EWallSide WallSide, const FDoorConfig& DoorConfig, float CustomThickness, float SmallerWallSize);
+
+	// Seams resolved across rooms while bDeferWallBuild is set (owners build them, dropped walls are skipped)
+	struct FSharedWall
+	{
+		bool bOwner = false;
+		float SeamThickness = 0.0f;
+		bool bHasNeighbourOpening = false;
+		FDoorConfig NeighbourOpening;
+		FVector NeighbourOpeningCenter = FVector::ZeroVector;
+	};
+	TMap<EWallSide, FSharedWall> SharedWalls;
+	void BuildSharedWall(UWorld* World, EWallSide WallSide, const FSharedWall& Seam, const FPendingWallEdit* OwnEdit);
+
+	// Instance handles of walls currently drawn by InstancedWalls (EWallSide::None = floor)
+	TMap<EWallSide, int32> InstancedWallHandles;
+
+	// Collision boxes per section of MergedRoomActor (world space) - the component takes them all at once
+	TMap<int32, TArray<TArray<FVector>>> MergedSectionHulls;
+	void UpdateMergedCollision();
+
 	// Utility methods
 	EWallSide GetOppositeWall(EWallSide WallSide) const;
 	void CreateRoomNumberText(int32 RoomIndex, bool bShowNumbers = true);
@@ -0,0 +1,240 @@
+#include "ChunkMeshBuilder.h"
+
+#include "../WallUnit/WallMaterialCache.h"
+#include "Engine/World.h"
+#include "ProceduralMeshComponent.h"
+#include "HAL/PlatformTime.h"
+
+FChunkMeshBuilder::FChunkMeshBuilder() {}
+
+void FChunkMeshBuilder::Initialize(UWorld* World, float ChunkSizeMeters, bool bAsyncCooking)
+{
+	// Drop chunks from any previous layout
+	for (TPair<FIntPoint, FMeshChunk>& Pair : Chunks)
+	{
+		if (AActor* ChunkActor = Pair.Value.Actor.Get())
+		{
+			ChunkActor->Destroy();
+		}
+	}
+	Chunks.Empty();
+	SurfaceToChunk.Empty();
+
+	WorldPtr = World;
+	ChunkSizeCm = FMath::Max(ChunkSizeMeters, 1.0f) * 100.0f;
+	bAsyncCollisionCooking = bAsyncCooking;
+	RebuildCounter = 0;
+}
+
+FIntPoint FChunkMeshBuilder::GetChunkCoord(const FVector& WorldPosition) const
+{
+	return FIntPoint(FMath::FloorToInt(WorldPosition.X / ChunkSizeCm), FMath::FloorToInt(WorldPosition.Y / ChunkSizeCm));
+}
+
+FChunkMeshBuilder::FMeshChunk& FChunkMeshBuilder::FindOrAddChunk(const FIntPoint& Coord)
+{
+	FMeshChunk& Chunk = Chunks.FindOrAdd(Coord);
+	if (Chunk.Actor.IsValid() || !WorldPtr.IsValid())
+	{
+		return Chunk;
+	}
+
+	// One actor and mesh component per chunk, located at the cell center
+	AActor* ChunkActor = WorldPtr->SpawnActor<AActor>();
+	UProceduralMeshComponent* ChunkMesh = NewObject<UProceduralMeshComponent>(ChunkActor);
+	ChunkActor->SetRootComponent(ChunkMesh);
+
+	// Setup collision settings - standard wall configuration
+	ChunkMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	ChunkMesh->SetCollisionObjectType(ECollisionChannel::ECC_WorldStatic);
+	ChunkMesh->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Block);
+	ChunkMesh->bUseComplexAsSimpleCollision = true;
+	ChunkMesh->bUseAsyncCooking = bAsyncCollisionCooking;
+	ChunkMesh->RegisterComponent();
+
+	ChunkActor->SetActorLocation(FVector((Coord.X + 0.5f) * ChunkSizeCm, (Coord.Y + 0.5f) * ChunkSizeCm, 0.0f));
+
+	Chunk.Actor = ChunkActor;
+	return Chunk;
+}
+
+AActor* FChunkMeshBuilder::SetSurfaceGeometry(const UObject* Room, int32 SurfaceIndex, const FVector& RoomCenter,
+                                              TArray<FVector>&& Vertices, TArray<int32>&& Triangles,
+                                              TArray<FVector>&& Normals, TArray<FVector2D>&& UVs,
+                                              const FLinearColor& Color, TArray<TArray<FVector>>&& CollisionHulls)
+{
+	const FSurfaceKey Key(Room, SurfaceIndex);
+	const FIntPoint Coord = GetChunkCoord(RoomCenter);
+
+	// A room only ever lives in one chunk, but guard against a moved room
+	if (const FIntPoint* PreviousCoord = SurfaceToChunk.Find(Key))
+	{
+		if (*PreviousCoord != Coord)
+		{
+			RemoveSurfaceGeometry(Room, SurfaceIndex);
+		}
+	}
+
+	FMeshChunk& Chunk = FindOrAddChunk(Coord);
+	FChunkSurface& Surface = Chunk.Surfaces.FindOrAdd(Key);
+	Surface.Vertices = MoveTemp(Vertices);
+	Surface.Triangles = MoveTemp(Triangles);
+	Surface.Normals = MoveTemp(Normals);
+	Surface.UVs = MoveTemp(UVs);
+	Surface.Color = Color;
+	Surface.CollisionHulls = MoveTemp(CollisionHulls);
+
+	Chunk.bDirty = true;
+	SurfaceToChunk.Add(Key, Coord);
+	return Chunk.Actor.Get();
+}
+
+void FChunkMeshBuilder::RemoveSurfaceGeometry(const UObject* Room, int32 SurfaceIndex)
+{
+	const FSurfaceKey Key(Room, SurfaceIndex);
+	FIntPoint Coord;
+	if (!SurfaceToChunk.RemoveAndCopyValue(Key, Coord))
+	{
+		return;
+	}
+
+	if (FMeshChunk* Chunk = Chunks.Find(Coord))
+	{
+		Chunk->Surfaces.Remove(Key);
+		Chunk->bDirty = true;
+	}
+}
+
+int32 FChunkMeshBuilder::RebuildDirtyChunks()
+{
+	int32 RebuiltCount = 0;
+	const double RebuildStart = FPlatformTime::Seconds();
+	for (TPair<FIntPoint, FMeshChunk>& Pair : Chunks)
+	{
+		if (Pair.Value.bDirty)
+		{
+			RebuildChunk(Pair.Key, Pair.Value);
+			RebuiltCount++;
+		}
+	}
+
+	if (RebuiltCount > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[ChunkMeshBuilder] Rebuilt %d/%d chunks (%.0fm cells) in %.2f ms including collision"),
+		       RebuiltCount, Chunks.Num(), ChunkSizeCm / 100.0f, (FPlatformTime::Seconds() - RebuildStart) * 1000.0);
+	}
+	return RebuiltCount;
+}
+
+void FChunkMeshBuilder::RebuildChunk(const FIntPoint& Coord, FMeshChunk& Chunk)
+{
+	Chunk.bDirty = false;
+	RebuildCounter++;
+
+	AActor* ChunkActor = Chunk.Actor.Get();
+	UProceduralMeshComponent* ChunkMesh = ChunkActor ? Cast<UProceduralMeshComponent>(ChunkActor->GetRootComponent()) : nullptr;
+	if (!ChunkMesh)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[ChunkMeshBuilder] Chunk (%d,%d) has no mesh component"), Coord.X, Coord.Y);
+		return;
+	}
+
+	// Group surfaces by color - each color becomes one section (one material, one draw)
+	TMap<uint32, TArray<const FChunkSurface*>> SurfacesByColor;
+	bool bSimpleCollision = Chunk.Surfaces.Num() > 0;
+	for (const TPair<FSurfaceKey, FChunkSurface>& SurfacePair : Chunk.Surfaces)
+	{
+		SurfacesByColor.FindOrAdd(SurfacePair.Value.Color.ToFColor(true).ToPackedARGB()).Add(&SurfacePair.Value);
+		bSimpleCollision &= SurfacePair.Value.CollisionHulls.Num() > 0;
+	}
+
+	ChunkMesh->ClearAllMeshSections();
+
+	const FVector Origin = ChunkActor->GetActorLocation();
+
+	int32 SectionIndex = 0;
+	for (const TPair<uint32, TArray<const FChunkSurface*>>& ColorGroup : SurfacesByColor)
+	{
+		// Size the section buffers once
+		int32 NumVertices = 0;
+		int32 NumIndices = 0;
+		for (const FChunkSurface* Surface : ColorGroup.Value)
+		{
+			NumVertices += Surface->Vertices.Num();
+			NumIndices += Surface->Triangles.Num();
+		}
+
+		TArray<FVector> Vertices;
+		TArray<int32> Triangles;
+		TArray<FVector> Normals;
+		TArray<FVector2D> UVs;
+		Vertices.Reserve(NumVertices);
+		Triangles.Reserve(NumIndices);
+		Normals.Reserve(NumVertices);
+		UVs.Reserve(NumVertices);
+
+		// Concatenate surfaces, offsetting indices and moving vertices into chunk-local space
+		for (const FChunkSurface* Surface : ColorGroup.Value)
+		{
+			const int32 BaseIndex = Vertices.Num();
+			for (const FVector& Vertex : Surface->Vertices)
+			{
+				Vertices.Add(Vertex - Origin);
+			}
+			for (int32 Index : Surface->Triangles)
+			{
+				Triangles.Add(BaseIndex + Index);
+			}
+
+			// Keep attributes aligned with vertices, using the same fallbacks CreateMeshSection
+			// applies to a standalone surface whose attribute count doesn't match its vertex count
+			const bool bHasNormals = Surface->Normals.Num() == Surface->Vertices.Num();
+			const bool bHasUVs = Surface->UVs.Num() == Surface->Vertices.Num();
+			for (int32 i = 0; i < Surface->Vertices.Num(); i++)
+			{
+				Normals.Add(bHasNormals ? Surface->Normals[i] : FVector(0.0f, 0.0f, 1.0f));
+				UVs.Add(bHasUVs ? Surface->UVs[i] : FVector2D::ZeroVector);
+			}
+		}
+
+		ChunkMesh->CreateMeshSection(SectionIndex, Vertices, Triangles, Normals, UVs,
+			TArray<FColor>(), TArray<FProcMeshTangent>(), !bSimpleCollision);
+
+		// Apply colored material (shared with every other chunk and wall of this color)
+		ChunkMesh->SetMaterial(SectionIndex, UWallMaterialCache::GetColorMaterial(ColorGroup.Value[0]->Color));
+
+		SectionIndex++;
+	}
+
+	Chunk.NumSections = SectionIndex;
+
+	// Box collision for the whole chunk replaces cooking every section as a trimesh
+	TArray<TArray<FVector>> ChunkHulls;
+	if (bSimpleCollision)
+	{
+		for (const TPair<FSurfaceKey, FChunkSurface>& SurfacePair : Chunk.Surfaces)
+		{
+			for (const TArray<FVector>& Hull : SurfacePair.Value.CollisionHulls)
+			{
+				TArray<FVector>& LocalHull = ChunkHulls.Add_GetRef(Hull);
+				for (FVector& Vertex : LocalHull)
+				{
+					Vertex -= Origin;
+				}
+			}
+		}
+	}
+	ChunkMesh->bUseComplexAsSimpleCollision = !bSimpleCollision;
+	ChunkMesh->SetCollisionConvexMeshes(ChunkHulls);
+}
+
+void FChunkMeshBuilder::GetChunkStats(int32& OutChunks, int32& OutSections, int32& OutRebuilds) const
+{
+	OutChunks = Chunks.Num();
+	OutSections = 0;
+	for (const TPair<FIntPoint, FMeshChunk>& Pair : Chunks)
+	{
+		OutSections += Pair.Value.NumSections;
+	}
+	OutRebuilds = RebuildCounter;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IChunkMeshBuilder.h"
+
+/**
+ * Standard implementation of spatial chunk mesh building
+ * Concatenates wall and floor geometry of all rooms in an XY cell into one procedural mesh
+ *
+ * Features:
+ * - One actor per chunk, one mesh section per material (color) within the chunk
+ * - Per-surface geometry is retained so a changed room only re-concatenates its own chunk
+ * - Dirty tracking: new holes or neighbours rebuild only the affected chunks
+ * - Simple box collision when every surface provides it, otherwise complex-as-simple
+ */
+class FChunkMeshBuilder : public IChunkMeshBuilder
+{
+public:
+    /**
+     * Constructor - Service is standalone and uses UE_LOG for debugging
+     */
+    FChunkMeshBuilder();
+
+    // IChunkMeshBuilder interface
+    virtual void Initialize(UWorld* World, float ChunkSizeMeters, bool bAsyncCooking) override;
+
+    virtual AActor* SetSurfaceGeometry(const UObject* Room, int32 SurfaceIndex, const FVector& RoomCenter,
+                                       TArray<FVector>&& Vertices, TArray<int32>&& Triangles,
+                                       TArray<FVector>&& Normals, TArray<FVector2D>&& UVs,
+                                       const FLinearColor& Color, TArray<TArray<FVector>>&& CollisionHulls) override;
+
+    virtual void RemoveSurfaceGeometry(const UObject* Room, int32 SurfaceIndex) override;
+
+    virtual int32 RebuildDirtyChunks() override;
+
+    virtual void GetChunkStats(int32& OutChunks, int32& OutSections, int32& OutRebuilds) const override;
+
+private:
+    typedef TPair<const UObject*, int32> FSurfaceKey;
+
+    // Geometry of one room surface, kept in world space until its chunk is rebuilt
+    struct FChunkSurface
+    {
+        TArray<FVector> Vertices;
+        TArray<int32> Triangles;
+        TArray<FVector> Normals;
+        TArray<FVector2D> UVs;
+        FLinearColor Color;
+        TArray<TArray<FVector>> CollisionHulls;
+    };
+
+    struct FMeshChunk
+    {
+        TWeakObjectPtr<AActor> Actor;
+        TMap<FSurfaceKey, FChunkSurface> Surfaces;
+        int32 NumSections = 0;
+        bool bDirty = false;
+    };
+
+    TWeakObjectPtr<UWorld> WorldPtr;
+    float ChunkSizeCm = 5000.0f;
+    bool bAsyncCollisionCooking = false;
+    TMap<FIntPoint, FMeshChunk> Chunks;
+    TMap<FSurfaceKey, FIntPoint> SurfaceToChunk;
+    int32 RebuildCounter = 0;
+
+    /**
+     * Get the chunk cell containing a world position
+     */
+    FIntPoint GetChunkCoord(const FVector& WorldPosition) const;
+
+    /**
+     * Find or create the chunk for a cell (spawns its actor on first use)
+     */
+    FMeshChunk& FindOrAddChunk(const FIntPoint& Coord);
+
+    /**
+     * Concatenate all surfaces of a chunk into one section per color
+     */
+    void RebuildChunk(const FIntPoint& Coord, FMeshChunk& Chunk);
+};
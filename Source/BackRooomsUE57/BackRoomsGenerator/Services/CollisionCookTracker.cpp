@@ -0,0 +1,123 @@
+#include "CollisionCookTracker.h"
+
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "ProceduralMeshComponent.h"
+
+FCollisionCookTracker::FCollisionCookTracker() {}
+
+void FCollisionCookTracker::Initialize()
+{
+	Rooms.Empty();
+	NumPendingRooms = 0;
+}
+
+void FCollisionCookTracker::WatchComponent(const UObject* Room, UProceduralMeshComponent* Component)
+{
+	if (!Room || !Component)
+	{
+		return;
+	}
+
+	// The component only defers its cook in game worlds; otherwise the body setup is already built
+	const UWorld* World = Component->GetWorld();
+	if (!Component->bUseAsyncCooking || !World || !World->IsGameWorld())
+	{
+		return;
+	}
+
+	FRoomCooks& RoomCooks = Rooms.FindOrAdd(Room);
+	if (RoomCooks.bReported)
+	{
+		// Already walkable - later re-cuts replace collision that was in place
+		return;
+	}
+
+	// The cook just queued swaps a new body setup in when it finishes
+	UBodySetup* CurrentBodySetup = Component->GetBodySetup();
+	for (FWatchedCook& Cook : RoomCooks.Cooks)
+	{
+		if (Cook.Component.Get() == Component)
+		{
+			Cook.BodySetupBeforeCook = CurrentBodySetup;
+			return;
+		}
+	}
+
+	FWatchedCook& Cook = RoomCooks.Cooks.AddDefaulted_GetRef();
+	Cook.Component = Component;
+	Cook.BodySetupBeforeCook = CurrentBodySetup;
+}
+
+void FCollisionCookTracker::AddRoom(const UObject* Room)
+{
+	if (!Room)
+	{
+		return;
+	}
+
+	FRoomCooks& RoomCooks = Rooms.FindOrAdd(Room);
+	if (RoomCooks.bWaiting || RoomCooks.bReported)
+	{
+		return;
+	}
+
+	RoomCooks.bWaiting = true;
+	RoomCooks.WaitStartSeconds = FPlatformTime::Seconds();
+	NumPendingRooms++;
+}
+
+void FCollisionCookTracker::PollReadyRooms(TArray<const UObject*>& OutReadyRooms, double TimeoutSeconds)
+{
+	if (NumPendingRooms == 0)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	for (TPair<const UObject*, FRoomCooks>& Pair : Rooms)
+	{
+		FRoomCooks& RoomCooks = Pair.Value;
+		if (!RoomCooks.bWaiting)
+		{
+			continue;
+		}
+
+		RoomCooks.Cooks.RemoveAllSwap([](const FWatchedCook& Cook) { return IsCookFinished(Cook); });
+
+		const bool bTimedOut = RoomCooks.Cooks.Num() > 0 && Now - RoomCooks.WaitStartSeconds > TimeoutSeconds;
+		if (RoomCooks.Cooks.Num() > 0 && !bTimedOut)
+		{
+			continue;
+		}
+
+		if (bTimedOut)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[CollisionCookTracker] Room still waiting on %d collision cooks after %.1f s - reporting it ready"),
+			       RoomCooks.Cooks.Num(), Now - RoomCooks.WaitStartSeconds);
+		}
+
+		RoomCooks.Cooks.Empty();
+		RoomCooks.bWaiting = false;
+		RoomCooks.bReported = true;
+		NumPendingRooms--;
+		OutReadyRooms.Add(Pair.Key);
+	}
+}
+
+int32 FCollisionCookTracker::GetNumPendingRooms() const
+{
+	return NumPendingRooms;
+}
+
+bool FCollisionCookTracker::IsCookFinished(const FWatchedCook& Cook)
+{
+	UProceduralMeshComponent* Component = Cook.Component.Get();
+	if (!Component)
+	{
+		// Released walls never finish cooking and no longer need to
+		return true;
+	}
+	return Component->GetBodySetup() != Cook.BodySetupBeforeCook.Get();
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ICollisionCookTracker.h"
+
+class UBodySetup;
+
+/**
+ * Standard implementation of collision cook tracking
+ * An async cook swaps a new body setup into the component when it finishes, so each watched
+ * component remembers the body setup it had when the cook was queued and is done once that changes.
+ *
+ * Features:
+ * - Components are held weakly; destroyed components (released walls) no longer block their room
+ * - Re-watching a component (another section on a merged room actor) waits for the latest cook
+ * - Components without bUseAsyncCooking cooked synchronously and never block
+ */
+class FCollisionCookTracker : public ICollisionCookTracker
+{
+public:
+    /**
+     * Constructor - Service is standalone and uses UE_LOG for debugging
+     */
+    FCollisionCookTracker();
+
+    // ICollisionCookTracker interface
+    virtual void Initialize() override;
+
+    virtual void WatchComponent(const UObject* Room, UProceduralMeshComponent* Component) override;
+
+    virtual void AddRoom(const UObject* Room) override;
+
+    virtual void PollReadyRooms(TArray<const UObject*>& OutReadyRooms, double TimeoutSeconds) override;
+
+    virtual int32 GetNumPendingRooms() const override;
+
+private:
+    // A component with a cook in flight and the body setup it had before the cook was queued
+    struct FWatchedCook
+    {
+        TWeakObjectPtr<UProceduralMeshComponent> Component;
+        TWeakObjectPtr<UBodySetup> BodySetupBeforeCook;
+    };
+
+    struct FRoomCooks
+    {
+        TArray<FWatchedCook> Cooks;
+        double WaitStartSeconds = 0.0;
+        bool bWaiting = false;
+        bool bReported = false;
+    };
+
+    TMap<const UObject*, FRoomCooks> Rooms;
+    int32 NumPendingRooms = 0;
+
+    /**
+     * True once the component's queued cook has been swapped in (or can no longer finish)
+     */
+    static bool IsCookFinished(const FWatchedCook& Cook);
+};
@@ -0,0 +1,110 @@
+#include "DebugMarkerOverlay.h"
+
+#include "../WallUnit/WallMaterialCache.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Components/InstancedStaticMeshComponent.h"
+
+FDebugMarkerOverlay::FDebugMarkerOverlay() {}
+
+void FDebugMarkerOverlay::Initialize(UWorld* World, bool bVisible)
+{
+	// Drop markers from any previous layout
+	if (AActor* Host = HostActor.Get())
+	{
+		Host->Destroy();
+	}
+	HostActor.Reset();
+	Batches.Empty();
+	Markers.Empty();
+	NumBuiltMarkers = 0;
+
+	WorldPtr = World;
+	bMarkersVisible = bVisible;
+}
+
+void FDebugMarkerOverlay::AddMarker(const FVector& Position, float DiameterCm, const FLinearColor& Color)
+{
+	FMarker& Marker = Markers.AddDefaulted_GetRef();
+	Marker.Position = Position;
+	Marker.DiameterCm = DiameterCm;
+	Marker.Color = Color;
+
+	if (bMarkersVisible)
+	{
+		BuildPendingMarkers();
+	}
+}
+
+void FDebugMarkerOverlay::SetVisible(bool bVisible)
+{
+	bMarkersVisible = bVisible;
+	if (bVisible)
+	{
+		BuildPendingMarkers();
+	}
+	if (AActor* Host = HostActor.Get())
+	{
+		Host->SetActorHiddenInGame(!bVisible);
+	}
+}
+
+bool FDebugMarkerOverlay::IsVisible() const
+{
+	return bMarkersVisible;
+}
+
+void FDebugMarkerOverlay::GetMarkerStats(int32& OutMarkers, int32& OutComponents) const
+{
+	OutMarkers = Markers.Num();
+	OutComponents = Batches.Num();
+}
+
+void FDebugMarkerOverlay::BuildPendingMarkers()
+{
+	if (NumBuiltMarkers == Markers.Num() || !WorldPtr.IsValid())
+	{
+		return;
+	}
+
+	// Single host actor for all batches, located at the world origin so instance transforms stay in world space
+	if (!HostActor.IsValid())
+	{
+		AActor* Host = WorldPtr->SpawnActor<AActor>();
+		USceneComponent* Root = NewObject<USceneComponent>(Host);
+		Host->SetRootComponent(Root);
+		Root->RegisterComponent();
+		HostActor = Host;
+	}
+	AActor* Host = HostActor.Get();
+
+	UStaticMesh* SphereMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere"));
+	if (!SphereMesh)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[DebugMarkerOverlay] Failed to load /Engine/BasicShapes/Sphere"));
+		return;
+	}
+
+	for (; NumBuiltMarkers < Markers.Num(); NumBuiltMarkers++)
+	{
+		const FMarker& Marker = Markers[NumBuiltMarkers];
+		const uint32 ColorKey = Marker.Color.ToFColor(true).ToPackedARGB();
+
+		UInstancedStaticMeshComponent* MarkerInstances = Batches.FindRef(ColorKey).Get();
+		if (!MarkerInstances)
+		{
+			MarkerInstances = NewObject<UInstancedStaticMeshComponent>(Host);
+			MarkerInstances->SetStaticMesh(SphereMesh);
+			MarkerInstances->SetupAttachment(Host->GetRootComponent());
+			MarkerInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			MarkerInstances->SetCastShadow(false);
+			MarkerInstances->RegisterComponent();
+			MarkerInstances->SetMaterial(0, UWallMaterialCache::GetColorMaterial(Marker.Color));
+			Batches.Add(ColorKey, MarkerInstances);
+		}
+
+		// Unit sphere is 100cm across, so the scale is the diameter in meters
+		const FTransform InstanceTransform(FRotator::ZeroRotator, Marker.Position, FVector(Marker.DiameterCm / 100.0f));
+		MarkerInstances->AddInstance(InstanceTransform, true);
+	}
+}
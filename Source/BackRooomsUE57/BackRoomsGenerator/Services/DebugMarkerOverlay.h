@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IDebugMarkerOverlay.h"
+
+class UInstancedStaticMeshComponent;
+
+/**
+ * Standard implementation of the debug marker overlay
+ * Draws every marker as a scaled instance of /Engine/BasicShapes/Sphere
+ *
+ * Features:
+ * - One instanced mesh component per marker color on a single host actor, no collision, no shadows
+ * - Colors come from the shared color materials (markers use a handful of colors, so this stays a few components)
+ * - Nothing is spawned while the overlay is hidden; the first SetVisible(true) builds all recorded markers
+ */
+class FDebugMarkerOverlay : public IDebugMarkerOverlay
+{
+public:
+    /**
+     * Constructor - Service is standalone and uses UE_LOG for debugging
+     */
+    FDebugMarkerOverlay();
+
+    // IDebugMarkerOverlay interface
+    virtual void Initialize(UWorld* World, bool bVisible) override;
+
+    virtual void AddMarker(const FVector& Position, float DiameterCm, const FLinearColor& Color) override;
+
+    virtual void SetVisible(bool bVisible) override;
+
+    virtual bool IsVisible() const override;
+
+    virtual void GetMarkerStats(int32& OutMarkers, int32& OutComponents) const override;
+
+private:
+    struct FMarker
+    {
+        FVector Position = FVector::ZeroVector;
+        float DiameterCm = 100.0f;
+        FLinearColor Color = FLinearColor::White;
+    };
+
+    TWeakObjectPtr<UWorld> WorldPtr;
+    TWeakObjectPtr<AActor> HostActor;
+    TMap<uint32, TWeakObjectPtr<UInstancedStaticMeshComponent>> Batches;
+    TArray<FMarker> Markers;
+    int32 NumBuiltMarkers = 0;
+    bool bMarkersVisible = false;
+
+    /**
+     * Add instances for every recorded marker not built yet (spawns the host actor on first use)
+     */
+    void BuildPendingMarkers();
+};
@@ -11,7 +11,7 @@ int32 FGenerationOrchestrator::ExecuteProceduralGeneration(const FRoomData& Init
                                                            const FBackroomGenerationConfig& Config,
                                                            ICollisionDetectionService* CollisionService,
                                                            IRoomConnectionManager* ConnectionManager,
-                                                           TFunction<void(FRoomData&)> RoomCreator)
+                                                           TFunction<void(FRoomData&, const FRoomData&)> RoomCreator)
 {
 	// Initialize generation state
 	InitializeGeneration();
@@ -32,8 +32,8 @@ int32 FGenerationOrchestrator::ExecuteProceduralGeneration(const FRoomData& Init
 	OutGeneratedRooms.Reserve(Config.TotalRooms);
 	OutGeneratedRooms.Add(InitialRoom);
 
-	// Initialize random number generator
-	FRandomStream Random(FDateTime::Now().GetTicks());
+	// Initialize random number generator (a non-zero layout seed solves the same layout every run)
+	FRandomStream Random(Config.LayoutSeed != 0 ? Config.LayoutSeed : FDateTime::Now().GetTicks());
 
 	// Main generation loop
 	TArray<int32> AvailableRooms;              // Rooms with available connections
@@ -90,7 +90,7 @@ int32 FGenerationOrchestrator::ExecuteProceduralGeneration(const FRoomData& Init
 				LogDebug(TEXT("ERROR: No available rooms for connection"), Config);
 				break;
 			}
-			int32 RandomRoomIndex = AvailableRooms[FMath::RandRange(0, AvailableRooms.Num() - 1)];
+			int32 RandomRoomIndex = AvailableRooms[Random.RandRange(0, AvailableRooms.Num() - 1)];
 
 			// Fix: Add bounds checking for OutGeneratedRooms access
 			if (RandomRoomIndex < 0 || RandomRoomIndex >= OutGeneratedRooms.Num())
@@ -121,7 +121,7 @@ int32 FGenerationOrchestrator::ExecuteProceduralGeneration(const FRoomData& Init
 				LogDebug(TEXT("ERROR: No available connections"), Config);
 				continue;
 			}
-			int32 ConnectionIndex = AvailableConnections[FMath::RandRange(0, AvailableConnections.Num() - 1)];
+			int32 ConnectionIndex = AvailableConnections[Random.RandRange(0, AvailableConnections.Num() - 1)];
 			LogDebug(FString::Printf(TEXT("Selected connection index %d"), ConnectionIndex), Config);
 
 			// Try to generate a connected room
@@ -384,7 +384,7 @@ bool FGenerationOrchestrator::TryGenerateConnectedRoom(int32 RoomIndex,
                                                        const FBackroomGenerationConfig& Config,
                                                        ICollisionDetectionService* CollisionService,
                                                        IRoomConnectionManager* ConnectionManager,
-                                                       TFunction<void(FRoomData&)> RoomCreator,
+                                                       TFunction<void(FRoomData&, const FRoomData&)> RoomCreator,
                                                        FRandomStream& Random)
 {
 	// Try different room sizes for this connection
@@ -411,7 +411,8 @@ bool FGenerationOrchestrator::TryGenerateConnectedRoom(int32 RoomIndex,
 		FRoomData NewRoom = GenerateRoomOfCategory(Category,
 		                                           RoomIndex,
 		                                           Category == ERoomCategory::Stairs ? &SourceRoom : nullptr,
-		                                           ConnectionIndex);
+		                                           ConnectionIndex,
+		                                           Config.LayoutSeed != 0 ? Random.RandRange(1, MAX_int32 - 1) : 0);
 		LogDebug(FString::Printf(TEXT("Generated %s: %.1fx%.1fm"), *CategoryStr, NewRoom.Width, NewRoom.Length),
 		         Config);
 
@@ -457,14 +458,13 @@ void FGenerationOrchestrator::CleanupAvailableRooms(TArray<int32>& AvailableRoom
 FRoomData FGenerationOrchestrator::GenerateRoomOfCategory(ERoomCategory Category,
                                                           int32 RoomIndex,
                                                           const FRoomData* SourceRoom,
-                                                          int32 ConnectionIndex) const
+                                                          int32 ConnectionIndex,
+                                                          int32 RoomSeed) const
 {
 	// Create factory instance and use it to generate the room
 	FRoomStrategyFactory StrategyFactory;
 	if (IRoomGenerationStrategy* Strategy = StrategyFactory.CreateStrategy(Category))
 	{
-		// Note: Current strategy interface only supports Config+RoomIndex
-		// For stairs, we need to extend the interface or handle context differently
 		FBackroomGenerationConfig DummyConfig; // Temporary - should get proper config
 		DummyConfig.StandardRoomHeight = 3.0f;
 		DummyConfig.MinRoomSize = 2.0f;
@@ -473,7 +473,13 @@ FRoomData FGenerationOrchestrator::GenerateRoomOfCategory(ERoomCategory Category
 		DummyConfig.MaxHallwayWidth = 5.0f;
 		DummyConfig.MinHallwayLength = 4.0f;
 		DummyConfig.MaxHallwayLength = 12.0f;
+		DummyConfig.LayoutSeed = RoomSeed;
 
+		// Stairs take their direction and elevation from the room they connect to
+		if (SourceRoom)
+		{
+			return Strategy->GenerateConnectedRoom(DummyConfig, RoomIndex, *SourceRoom, ConnectionIndex);
+		}
 		return Strategy->GenerateRoom(DummyConfig, RoomIndex);
 	}
 
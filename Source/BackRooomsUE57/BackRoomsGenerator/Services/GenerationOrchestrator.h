@@ -34,7 +34,7 @@ public:
         const FBackroomGenerationConfig& Config,
         ICollisionDetectionService* CollisionService,
         IRoomConnectionManager* ConnectionManager,
-        TFunction<void(FRoomData&)> RoomCreator
+        TFunction<void(FRoomData&, const FRoomData&)> RoomCreator
     ) override;
     
     virtual void GetGenerationStats(int32& OutMainLoops, int32& OutConnectionRetries, 
@@ -103,7 +103,7 @@ private:
         const FBackroomGenerationConfig& Config,
         ICollisionDetectionService* CollisionService,
         IRoomConnectionManager* ConnectionManager,
-        TFunction<void(FRoomData&)> RoomCreator,
+        TFunction<void(FRoomData&, const FRoomData&)> RoomCreator,
         FRandomStream& Random);
     
     /**
@@ -120,11 +120,13 @@ private:
      * @param RoomIndex - Index for the new room
      * @param SourceRoom - Source room for context (stairs generation)
      * @param ConnectionIndex - Connection index for context (stairs generation)
+     * @param RoomSeed - Seed for this attempt's room size and direction (0 = time-seeded)
      * @return Generated room data
      */
     FRoomData GenerateRoomOfCategory(ERoomCategory Category, int32 RoomIndex,
                                     const FRoomData* SourceRoom = nullptr,
-                                    int32 ConnectionIndex = -1) const;
+                                    int32 ConnectionIndex = -1,
+                                    int32 RoomSeed = 0) const;
     
     /**
      * Calculate the opposite wall index for room connections
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Interface for spatial chunk mesh building
+ * Groups room geometry by XY cell so large layouts render as a few big primitives
+ */
+class IChunkMeshBuilder
+{
+public:
+    virtual ~IChunkMeshBuilder() = default;
+
+    /**
+     * Prepare the builder for a new layout (destroys any previous chunk actors)
+     * @param World - World to spawn chunk actors in
+     * @param ChunkSizeMeters - Edge length of one XY chunk cell
+     * @param bAsyncCooking - Cook chunk collision off the game thread (chunks block once their cook finishes)
+     */
+    virtual void Initialize(UWorld* World, float ChunkSizeMeters, bool bAsyncCooking = false) = 0;
+
+    /**
+     * Store or replace the geometry of one room surface and mark its chunk dirty
+     * Vertices are in world space; the chunk is chosen from RoomCenter so a room never straddles chunks
+     *
+     * @param Room - Room that owns the surface
+     * @param SurfaceIndex - Surface slot within the room (floor or wall side)
+     * @param RoomCenter - World-space room center used for chunk assignment
+     * @param Color - Surface color (one mesh section per color per chunk)
+     * @param CollisionHulls - World-space convex collision; a chunk whose surfaces all have hulls skips trimesh cooking
+     * @return Chunk actor the surface will be rendered by
+     */
+    virtual AActor* SetSurfaceGeometry(const UObject* Room, int32 SurfaceIndex, const FVector& RoomCenter,
+                                       TArray<FVector>&& Vertices, TArray<int32>&& Triangles,
+                                       TArray<FVector>&& Normals, TArray<FVector2D>&& UVs,
+                                       const FLinearColor& Color, TArray<TArray<FVector>>&& CollisionHulls) = 0;
+
+    /**
+     * Remove one room surface (wall removal / before re-cutting) and mark its chunk dirty
+     */
+    virtual void RemoveSurfaceGeometry(const UObject* Room, int32 SurfaceIndex) = 0;
+
+    /**
+     * Rebuild the mesh of every dirty chunk
+     * @return Number of chunks rebuilt
+     */
+    virtual int32 RebuildDirtyChunks() = 0;
+
+    /**
+     * Get chunk statistics
+     * @param OutChunks - Number of chunk actors
+     * @param OutSections - Total mesh sections across all chunks
+     * @param OutRebuilds - Total chunk rebuilds since Initialize
+     */
+    virtual void GetChunkStats(int32& OutChunks, int32& OutSections, int32& OutRebuilds) const = 0;
+};
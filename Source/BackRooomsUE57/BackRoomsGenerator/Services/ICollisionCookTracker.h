@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UProceduralMeshComponent;
+
+/**
+ * Interface for tracking asynchronous collision cooking of generated rooms
+ * Procedural mesh components cook off the game thread when bUseAsyncCooking is set;
+ * a room counts as walkable once every component it was drawn into has finished cooking.
+ */
+class ICollisionCookTracker
+{
+public:
+    virtual ~ICollisionCookTracker() = default;
+
+    /**
+     * Prepare the tracker for a new layout (forgets all rooms and components)
+     */
+    virtual void Initialize() = 0;
+
+    /**
+     * Record that a room's collision was (re)submitted on a mesh component
+     * The watch completes with the next cook the component swaps in, so call it after the section
+     * upload or - for components rebuilt later, like chunks - before the rebuild
+     *
+     * @param Room - Room whose geometry lives (partly) on the component
+     * @param Component - Component that queued the cook (may be shared between rooms, e.g. chunks)
+     */
+    virtual void WatchComponent(const UObject* Room, UProceduralMeshComponent* Component) = 0;
+
+    /**
+     * Start waiting for a room - it is reported once all watched components have cooked
+     * Rooms without watched components (instanced or synchronously cooked) are ready on the next poll
+     */
+    virtual void AddRoom(const UObject* Room) = 0;
+
+    /**
+     * Check pending rooms and move the ones whose collision is in place to OutReadyRooms
+     * @param TimeoutSeconds - Rooms still waiting after this long are reported anyway (with a warning)
+     */
+    virtual void PollReadyRooms(TArray<const UObject*>& OutReadyRooms, double TimeoutSeconds) = 0;
+
+    /**
+     * Number of rooms added but not yet reported ready
+     */
+    virtual int32 GetNumPendingRooms() const = 0;
+};
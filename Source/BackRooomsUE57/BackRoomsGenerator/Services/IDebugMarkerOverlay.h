@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+/**
+ * Interface for the debug marker overlay
+ * Identifier and hallway spheres are all drawn as instances of one sphere mesh on a single host actor
+ * instead of a static mesh actor or component (and a mesh load) per marker.
+ */
+class IDebugMarkerOverlay
+{
+public:
+    virtual ~IDebugMarkerOverlay() = default;
+
+    /**
+     * Prepare the overlay for a new layout (destroys the previous layout's markers)
+     * @param World - World to spawn the host actor in
+     * @param bVisible - Draw markers; hidden markers are only recorded and cost no components until shown
+     */
+    virtual void Initialize(UWorld* World, bool bVisible) = 0;
+
+    /**
+     * Add one sphere marker
+     * @param Position - World-space center
+     * @param DiameterCm - Sphere diameter in cm
+     * @param Color - Marker color (one shared material and instanced component per color)
+     */
+    virtual void AddMarker(const FVector& Position, float DiameterCm, const FLinearColor& Color) = 0;
+
+    /**
+     * Runtime toggle - showing builds the instances of every marker recorded so far, hiding keeps them for later
+     */
+    virtual void SetVisible(bool bVisible) = 0;
+
+    virtual bool IsVisible() const = 0;
+
+    /**
+     * Get overlay statistics
+     * @param OutMarkers - Markers recorded for this layout
+     * @param OutComponents - Instanced mesh components (one per color, none while never shown)
+     */
+    virtual void GetMarkerStats(int32& OutMarkers, int32& OutComponents) const = 0;
+};
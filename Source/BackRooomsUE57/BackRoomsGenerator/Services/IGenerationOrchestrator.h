@@ -22,7 +22,7 @@ public:
      * @param Config - Configuration settings
      * @param CollisionService - Service for collision detection
      * @param ConnectionManager - Service for room connections
-     * @param RoomCreator - Callback function to create actual UE room units
+     * @param RoomCreator - Callback function to create actual UE room units (new room, room it was placed from)
      * @return Number of rooms successfully generated
      */
     virtual int32 ExecuteProceduralGeneration(
@@ -31,7 +31,7 @@ public:
         const FBackroomGenerationConfig& Config,
         class ICollisionDetectionService* CollisionService,
         class IRoomConnectionManager* ConnectionManager,
-        TFunction<void(FRoomData&)> RoomCreator
+        TFunction<void(FRoomData&, const FRoomData&)> RoomCreator
     ) = 0;
     
     /**
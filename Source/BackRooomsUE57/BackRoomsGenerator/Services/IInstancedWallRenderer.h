@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Interface for instanced solid wall rendering
+ * Solid walls and floors are plain boxes, so they can be drawn as instances of one unit-box mesh
+ */
+class IInstancedWallRenderer
+{
+public:
+    virtual ~IInstancedWallRenderer() = default;
+
+    /**
+     * Prepare the renderer for a new layout (destroys any previous instances)
+     * @param World - World to spawn the instance host actor in
+     */
+    virtual void Initialize(UWorld* World) = 0;
+
+    /**
+     * Add one solid wall box, same placement rules as UWallUnit::CreateSolidWallActor
+     * @param Position - World-space wall center
+     * @param Rotation - Wall rotation (X = width, Y = thickness, Z = height before rotation)
+     * @param WallWidth - Width in meters
+     * @param WallHeight - Height in meters
+     * @param WallThickness - Thickness in meters
+     * @param Color - Wall color (stored as per-instance custom data)
+     * @return Stable handle for RemoveWall, INDEX_NONE on failure
+     */
+    virtual int32 AddWall(const FVector& Position, const FRotator& Rotation,
+                          float WallWidth, float WallHeight, float WallThickness,
+                          const FLinearColor& Color) = 0;
+
+    /**
+     * Remove a wall previously added with AddWall (wall replaced by a holed wall or removed)
+     */
+    virtual void RemoveWall(int32 Handle) = 0;
+
+    /**
+     * Actor hosting all instance components
+     */
+    virtual AActor* GetHostActor() const = 0;
+
+    /**
+     * Get instance statistics
+     * @param OutInstances - Live wall instances
+     * @param OutComponents - Instanced mesh components (one per color)
+     */
+    virtual void GetInstanceStats(int32& OutInstances, int32& OutComponents) const = 0;
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../Types.h"
+
+/**
+ * Interface for the on-disk layout cache
+ * A solved layout (room placement, sizes, categories and connections) is written to a small versioned binary file,
+ * so the next session can skip the placement loop and go straight to building geometry.
+ * Positions are stored relative to the first (initial) room, so a cached layout follows the player start.
+ */
+class ILayoutCache
+{
+public:
+    virtual ~ILayoutCache() = default;
+
+    /**
+     * Read a cached layout
+     * Fails (and leaves OutRooms empty) when the file is missing, from another format version, or was solved
+     * with a different layout config hash or seed
+     *
+     * @param FilePath - Absolute path of the layout file
+     * @param ConfigHash - Hash of the layout settings the caller would solve with
+     * @param Seed - Layout seed the caller would solve with
+     * @param Origin - World position of the first (initial) room this session; every room is moved along with it
+     * @param OutRooms - Rooms of the cached layout, without room units (the initial room first)
+     * @return True if the layout was loaded
+     */
+    virtual bool LoadLayout(const FString& FilePath, uint32 ConfigHash, int32 Seed, const FVector& Origin, TArray<FRoomData>& OutRooms) = 0;
+
+    /**
+     * Write a solved layout, replacing any previous file
+     * @param FilePath - Absolute path of the layout file (missing directories are created)
+     * @param ConfigHash - Hash of the layout settings the layout was solved with
+     * @param Seed - Layout seed the layout was solved with
+     * @param Rooms - Generated rooms, the initial room first (room units are not stored, positions are stored relative to it)
+     * @return True if the file was written
+     */
+    virtual bool SaveLayout(const FString& FilePath, uint32 ConfigHash, int32 Seed, const TArray<FRoomData>& Rooms) = 0;
+
+    /**
+     * Get statistics of the last load or save
+     * @param OutFileBytes - Size of the layout file
+     * @param OutSeconds - Time spent reading and decoding (load) or encoding and writing (save)
+     */
+    virtual void GetCacheStats(int64& OutFileBytes, double& OutSeconds) const = 0;
+};
@@ -23,7 +23,7 @@ public:
      * @param ExistingRooms - Array of all existing rooms for collision checking
      * @param Config - Configuration settings
      * @param CollisionService - Service for collision detection
-     * @param RoomCreator - Callback function to create the actual room unit
+     * @param RoomCreator - Callback function to create the actual room unit (new room, source room)
      * @return True if room was successfully placed
      */
     virtual bool TryPlaceRoom(const FRoomData& SourceRoom, 
@@ -32,7 +32,7 @@ public:
                              const TArray<FRoomData>& ExistingRooms,
                              const FBackroomGenerationConfig& Config,
                              class ICollisionDetectionService* CollisionService,
-                             TFunction<void(FRoomData&)> RoomCreator) = 0;
+                             TFunction<void(FRoomData&, const FRoomData&)> RoomCreator) = 0;
     
     /**
      * Connect two rooms together with appropriate connection type and width
@@ -50,6 +50,14 @@ public:
                              int32 Connection2Index,
                              const FBackroomGenerationConfig& Config) = 0;
     
+    /**
+     * Cut the physical hole of every used connection of a room
+     * For layouts that were not placed through ConnectRooms (e.g. loaded from the layout cache)
+     *
+     * @param Room - Room with its room unit and final connections
+     */
+    virtual void RebuildPhysicalConnections(FRoomData& Room) = 0;
+    
     /**
      * Create connection points for a room based on its category
      * Different room types have different connection patterns
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../Types.h"
+
+/**
+ * Interface for room level of detail
+ * Every registered room has a full-detail set of actors and a cheap proxy actor (box shell, openings covered);
+ * only rooms near the viewer are drawn at full detail, so draw cost follows what is close rather than layout size.
+ */
+class IRoomLodManager
+{
+public:
+    virtual ~IRoomLodManager() = default;
+
+    /**
+     * Prepare the manager for a new layout (destroys proxies of any previous layout)
+     */
+    virtual void Initialize() = 0;
+
+    /**
+     * Register or refresh a room - the room starts at full detail with its proxy hidden
+     * Registering a room again replaces its detail actors (walls re-cut after generation) and proxy
+     *
+     * @param RoomIndex - Room index used by room connections
+     * @param Bounds - World-space room bounds used for the distance metric and to locate the viewer
+     * @param ConnectedRooms - Indices of the rooms this one connects to (room graph edges)
+     * @param ProxyActor - Proxy actor owned by the manager from now on (destroyed on Initialize)
+     * @param DetailActors - Actors drawn only at full detail; must not be shared with other rooms
+     */
+    virtual void RegisterRoom(int32 RoomIndex, const FBox& Bounds, const TArray<int32>& ConnectedRooms,
+                              AActor* ProxyActor, const TArray<AActor*>& DetailActors) = 0;
+
+    /**
+     * Swap rooms between full detail and proxy for a viewer position
+     * @param ViewerLocation - World-space viewer (camera) location
+     * @param Metric - Measure rooms by distance to their bounds or by room-graph hops from the viewer's room
+     * @param ProxyDistanceCm - Rooms farther than this are drawn as proxies (Distance metric)
+     * @param ProxyHops - Rooms more than this many connections away are drawn as proxies (GraphHops metric)
+     * @return Number of rooms swapped by this update
+     */
+    virtual int32 UpdateLod(const FVector& ViewerLocation, ERoomLodMetric Metric, float ProxyDistanceCm, int32 ProxyHops) = 0;
+
+    /**
+     * Get LOD statistics
+     * @param OutRooms - Registered rooms
+     * @param OutProxyRooms - Rooms currently drawn as proxies
+     * @param OutDrawnTriangles - Triangles of everything currently drawn (detail or proxy)
+     * @param OutFullTriangles - Triangles if every room were drawn at full detail
+     */
+    virtual void GetLodStats(int32& OutRooms, int32& OutProxyRooms, int32& OutDrawnTriangles, int32& OutFullTriangles) const = 0;
+};
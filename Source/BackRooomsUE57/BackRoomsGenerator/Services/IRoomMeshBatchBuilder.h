@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../WallUnit/HoleDescriptor.h"
+
+/**
+ * Interface for batched room mesh building
+ * Wall geometry is pure math, so it is collected while rooms are placed and built for all
+ * rooms at once on worker threads; only component creation and section upload stay on the game thread.
+ */
+class IRoomMeshBatchBuilder
+{
+public:
+    virtual ~IRoomMeshBatchBuilder() = default;
+
+    /**
+     * Called on the game thread with the finished world-space mesh of one queued wall
+     * and its collision boxes as convex hulls (8 world-space corners each)
+     */
+    typedef TFunction<void(TArray<FVector>&& Vertices, TArray<int32>&& Triangles,
+                           TArray<FVector>&& Normals, TArray<FVector2D>&& UVs,
+                           TArray<TArray<FVector>>&& CollisionHulls)> FSubmitWallMesh;
+
+    /**
+     * Prepare the builder for a new layout (drops any walls still queued)
+     */
+    virtual void Initialize() = 0;
+
+    /**
+     * Queue or replace the mesh build of one room surface
+     * The hole must already be compiled - compiling draws random numbers and stays on the game thread
+     *
+     * @param Room - Room that owns the surface
+     * @param SurfaceIndex - Surface slot within the room (floor or wall side)
+     * @param Position - World-space wall center
+     * @param Rotation - Wall rotation
+     * @param WallWidth - Width in meters
+     * @param WallHeight - Height in meters
+     * @param WallThickness - Thickness in meters
+     * @param Hole - Compiled hole, nullptr for a solid wall
+     * @param Submit - Receives the built mesh on the game thread
+     */
+    virtual void QueueWall(const UObject* Room, int32 SurfaceIndex, const FVector& Position, const FRotator& Rotation,
+                           float WallWidth, float WallHeight, float WallThickness, const FResolvedHole* Hole,
+                           FSubmitWallMesh&& Submit) = 0;
+
+    /**
+     * Drop a queued surface (wall removal / before re-cutting)
+     * @return True if the surface was still queued
+     */
+    virtual bool CancelWall(const UObject* Room, int32 SurfaceIndex) = 0;
+
+    /**
+     * Build every queued wall in parallel, then hand each mesh to its submit callback on the game thread
+     * @return Number of walls submitted
+     */
+    virtual int32 BuildAndSubmit() = 0;
+
+    /**
+     * Get batch statistics since Initialize
+     * @param OutBatches - Number of non-empty BuildAndSubmit calls
+     * @param OutWalls - Total walls built
+     * @param OutBuildSeconds - Time spent in the parallel build phase
+     * @param OutSubmitSeconds - Time spent submitting meshes on the game thread
+     */
+    virtual void GetBatchStats(int32& OutBatches, int32& OutWalls, double& OutBuildSeconds, double& OutSubmitSeconds) const = 0;
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UWorld;
+
+/**
+ * Interface for pooling standalone wall actors
+ * Released walls are parked hidden and without collision instead of being destroyed, and the next wall
+ * built takes one back and replaces its mesh in place - a door cut reuses the very actor it released.
+ */
+class IWallActorPool
+{
+public:
+    virtual ~IWallActorPool() = default;
+
+    /**
+     * Prepare the pool for a new layout (destroys parked actors of any previous layout, resets statistics)
+     */
+    virtual void Initialize() = 0;
+
+    /**
+     * Get an empty-or-stale wall actor ready for UWallUnit::SetWallActorMesh
+     * Reuses the most recently released actor of the same world, otherwise spawns a new one
+     *
+     * @param World - World the wall lives in
+     * @param bAsyncCooking - Cook the wall's collision off the game thread
+     * @return Visible, collision-enabled wall actor (nullptr without a world)
+     */
+    virtual AActor* Acquire(UWorld* World, bool bAsyncCooking) = 0;
+
+    /**
+     * Park a wall actor for reuse - it is hidden and stops blocking immediately
+     * Streaming / despawn logic can release walls here as well
+     */
+    virtual void Release(AActor* WallActor) = 0;
+
+    /**
+     * Get pool statistics since the last Initialize
+     * @param OutSpawned - Actors spawned because the pool was empty
+     * @param OutReused - Acquires served from the pool
+     * @param OutReleased - Actors handed back
+     * @param OutParked - Actors currently waiting in the pool
+     */
+    virtual void GetPoolStats(int32& OutSpawned, int32& OutReused, int32& OutReleased, int32& OutParked) const = 0;
+};
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../Types.h"
+
+/**
+ * Interface for resolving walls shared between adjacent rooms
+ * Two rooms that face each other across a thin seam (North/South or East/West walls on the same floor)
+ * would each build their own wall there; the resolver gives the seam to one room and drops the other's wall.
+ */
+class IWallGraphResolver
+{
+public:
+    virtual ~IWallGraphResolver() = default;
+
+    /**
+     * Find coincident wall segments across all rooms and hand each seam to a single owner room
+     * Rooms must still be deferring their walls (two-phase build) - owners build the seam wall in BuildDeferredGeometry
+     *
+     * @param Rooms - Generated rooms with their room units
+     * @param WallThickness - Regular wall thickness in meters (the widest seam merged is this plus a small tolerance)
+     * @return Number of seams given to an owner room
+     */
+    virtual int32 ResolveSharedWalls(const TArray<FRoomData>& Rooms, float WallThickness) = 0;
+
+    /**
+     * Get statistics of the last ResolveSharedWalls
+     * @param OutSeams - Owner walls that now cover one or more neighbours
+     * @param OutDroppedWalls - Walls that will not be built because a neighbour owns the seam
+     * @param OutMergedOpenings - Connection openings cut into an owner's seam wall instead of two separate walls
+     */
+    virtual void GetGraphStats(int32& OutSeams, int32& OutDroppedWalls, int32& OutMergedOpenings) const = 0;
+};
@@ -0,0 +1,143 @@
+#include "InstancedWallRenderer.h"
+
+#include "../WallUnit/WallMaterialCache.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+
+FInstancedWallRenderer::FInstancedWallRenderer() {}
+
+void FInstancedWallRenderer::Initialize(UWorld* World)
+{
+	// Drop instances from any previous layout
+	if (AActor* Host = HostActor.Get())
+	{
+		Host->Destroy();
+	}
+	HostActor.Reset();
+	Batches.Empty();
+	HandleLocations.Empty();
+	NextHandle = 0;
+
+	WorldPtr = World;
+}
+
+FInstancedWallRenderer::FWallBatch* FInstancedWallRenderer::FindOrAddBatch(uint32 ColorKey, const FLinearColor& Color)
+{
+	FWallBatch* Batch = Batches.Find(ColorKey);
+	if (Batch && Batch->Component.IsValid())
+	{
+		return Batch;
+	}
+
+	if (!WorldPtr.IsValid())
+	{
+		return nullptr;
+	}
+
+	// Single host actor for all batches, located at the world origin so instance transforms stay in world space
+	if (!HostActor.IsValid())
+	{
+		AActor* Host = WorldPtr->SpawnActor<AActor>();
+		USceneComponent* Root = NewObject<USceneComponent>(Host);
+		Host->SetRootComponent(Root);
+		Root->RegisterComponent();
+		HostActor = Host;
+	}
+
+	UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube"));
+	if (!CubeMesh)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[InstancedWallRenderer] Failed to load /Engine/BasicShapes/Cube"));
+		return nullptr;
+	}
+
+	AActor* Host = HostActor.Get();
+	UHierarchicalInstancedStaticMeshComponent* WallInstances = NewObject<UHierarchicalInstancedStaticMeshComponent>(Host);
+	WallInstances->SetStaticMesh(CubeMesh);
+	WallInstances->SetupAttachment(Host->GetRootComponent());
+
+	// Setup collision settings - standard wall configuration
+	WallInstances->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	WallInstances->SetCollisionObjectType(ECollisionChannel::ECC_WorldStatic);
+	WallInstances->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Block);
+	WallInstances->RegisterComponent();
+
+	// Apply colored material
+	WallInstances->SetMaterial(0, UWallMaterialCache::GetColorMaterial(Color));
+
+	FWallBatch& NewBatch = Batches.FindOrAdd(ColorKey);
+	NewBatch.Component = WallInstances;
+	NewBatch.InstanceHandles.Reset();
+	return &NewBatch;
+}
+
+int32 FInstancedWallRenderer::AddWall(const FVector& Position, const FRotator& Rotation,
+                                      float WallWidth, float WallHeight, float WallThickness,
+                                      const FLinearColor& Color)
+{
+	const uint32 ColorKey = Color.ToFColor(true).ToPackedARGB();
+	FWallBatch* Batch = FindOrAddBatch(ColorKey, Color);
+	if (!Batch)
+	{
+		return INDEX_NONE;
+	}
+
+	// Unit cube is 100cm, so the scale is the wall size in meters (X = width, Y = thickness, Z = height)
+	const FTransform InstanceTransform(Rotation, Position, FVector(WallWidth, WallThickness, WallHeight));
+
+	UHierarchicalInstancedStaticMeshComponent* WallInstances = Batch->Component.Get();
+	const int32 InstanceIndex = WallInstances->AddInstance(InstanceTransform, true);
+
+	const int32 Handle = NextHandle++;
+	check(InstanceIndex == Batch->InstanceHandles.Num());
+	Batch->InstanceHandles.Add(Handle);
+
+	FInstanceLocation& Location = HandleLocations.Add(Handle);
+	Location.ColorKey = ColorKey;
+	Location.InstanceIndex = InstanceIndex;
+	return Handle;
+}
+
+void FInstancedWallRenderer::RemoveWall(int32 Handle)
+{
+	FInstanceLocation Location;
+	if (!HandleLocations.RemoveAndCopyValue(Handle, Location))
+	{
+		return;
+	}
+
+	FWallBatch* Batch = Batches.Find(Location.ColorKey);
+	UHierarchicalInstancedStaticMeshComponent* WallInstances = Batch ? Batch->Component.Get() : nullptr;
+	if (!WallInstances)
+	{
+		return;
+	}
+
+	// Move the last instance into the freed slot, then drop the last slot - only the moved handle changes index
+	const int32 LastIndex = Batch->InstanceHandles.Num() - 1;
+	if (Location.InstanceIndex != LastIndex)
+	{
+		FTransform LastTransform;
+		WallInstances->GetInstanceTransform(LastIndex, LastTransform, true);
+		WallInstances->UpdateInstanceTransform(Location.InstanceIndex, LastTransform, true, false, true);
+
+		const int32 MovedHandle = Batch->InstanceHandles[LastIndex];
+		Batch->InstanceHandles[Location.InstanceIndex] = MovedHandle;
+		HandleLocations[MovedHandle].InstanceIndex = Location.InstanceIndex;
+	}
+
+	WallInstances->RemoveInstance(LastIndex);
+	Batch->InstanceHandles.RemoveAt(LastIndex);
+}
+
+AActor* FInstancedWallRenderer::GetHostActor() const
+{
+	return HostActor.Get();
+}
+
+void FInstancedWallRenderer::GetInstanceStats(int32& OutInstances, int32& OutComponents) const
+{
+	OutInstances = HandleLocations.Num();
+	OutComponents = Batches.Num();
+}
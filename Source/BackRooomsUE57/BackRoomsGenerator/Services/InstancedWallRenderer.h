@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IInstancedWallRenderer.h"
+
+class UHierarchicalInstancedStaticMeshComponent;
+
+/**
+ * Standard implementation of instanced solid wall rendering
+ * Draws every solid wall and floor as a scaled instance of /Engine/BasicShapes/Cube
+ *
+ * Features:
+ * - One hierarchical instanced mesh component per wall color on a single host actor (color comes from its material)
+ * - Stable handles: removal swaps the last instance into the freed slot
+ */
+class FInstancedWallRenderer : public IInstancedWallRenderer
+{
+public:
+    /**
+     * Constructor - Service is standalone and uses UE_LOG for debugging
+     */
+    FInstancedWallRenderer();
+
+    // IInstancedWallRenderer interface
+    virtual void Initialize(UWorld* World) override;
+
+    virtual int32 AddWall(const FVector& Position, const FRotator& Rotation,
+                          float WallWidth, float WallHeight, float WallThickness,
+                          const FLinearColor& Color) override;
+
+    virtual void RemoveWall(int32 Handle) override;
+
+    virtual AActor* GetHostActor() const override;
+
+    virtual void GetInstanceStats(int32& OutInstances, int32& OutComponents) const override;
+
+private:
+    // Per-color instance batch; InstanceHandles[i] is the handle owning instance i
+    struct FWallBatch
+    {
+        TWeakObjectPtr<UHierarchicalInstancedStaticMeshComponent> Component;
+        TArray<int32> InstanceHandles;
+    };
+
+    // Where a handle's instance currently lives
+    struct FInstanceLocation
+    {
+        uint32 ColorKey = 0;
+        int32 InstanceIndex = INDEX_NONE;
+    };
+
+    TWeakObjectPtr<UWorld> WorldPtr;
+    TWeakObjectPtr<AActor> HostActor;
+    TMap<uint32, FWallBatch> Batches;
+    TMap<int32, FInstanceLocation> HandleLocations;
+    int32 NextHandle = 0;
+
+    /**
+     * Find or create the instance batch for a color (spawns the host actor on first use)
+     */
+    FWallBatch* FindOrAddBatch(uint32 ColorKey, const FLinearColor& Color);
+};
@@ -0,0 +1,195 @@
+#include "LayoutCache.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+FLayoutCache::FLayoutCache() {}
+
+void FLayoutCache::SerializeRoom(FArchive& Ar, FRoomData& Room)
+{
+	uint8 Category = (uint8)Room.Category;
+	uint8 StairDirection = (uint8)Room.StairDirection;
+	Ar << Room.RoomIndex;
+	Ar << Category;
+	Ar << Room.Position;
+	Ar << Room.Width;
+	Ar << Room.Length;
+	Ar << Room.Height;
+	Ar << Room.Elevation;
+	Ar << StairDirection;
+	Room.Category = (ERoomCategory)Category;
+	Room.StairDirection = (EWallSide)StairDirection;
+
+	// A room has at most one connection per wall side
+	uint8 NumConnections = (uint8)FMath::Min(Room.Connections.Num(), 255);
+	Ar << NumConnections;
+	if (Ar.IsLoading())
+	{
+		Room.Connections.SetNum(NumConnections);
+	}
+
+	for (int32 ConnectionIndex = 0; ConnectionIndex < NumConnections; ConnectionIndex++)
+	{
+		FRoomConnection& Connection = Room.Connections[ConnectionIndex];
+		uint8 WallSide = (uint8)Connection.WallSide;
+		uint8 ConnectionType = (uint8)Connection.ConnectionType;
+		uint8 bIsUsed = Connection.bIsUsed ? 1 : 0;
+		Ar << WallSide;
+		Ar << ConnectionType;
+		Ar << bIsUsed;
+		Ar << Connection.ConnectionPoint;
+		Ar << Connection.ConnectionWidth;
+		Ar << Connection.ConnectedRoomIndex;
+		Connection.WallSide = (EWallSide)WallSide;
+		Connection.ConnectionType = (EConnectionType)ConnectionType;
+		Connection.bIsUsed = bIsUsed != 0;
+	}
+}
+
+void FLayoutCache::OffsetRoom(FRoomData& Room, const FVector& Offset)
+{
+	Room.Position += Offset;
+	for (FRoomConnection& Connection : Room.Connections)
+	{
+		Connection.ConnectionPoint += Offset;
+	}
+}
+
+bool FLayoutCache::LoadLayout(const FString& FilePath, uint32 ConfigHash, int32 Seed, const FVector& Origin, TArray<FRoomData>& OutRooms)
+{
+	OutRooms.Reset();
+	LastFileBytes = 0;
+	LastSeconds = 0.0;
+
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint32 FileConfigHash = 0;
+	int32 FileSeed = 0;
+	int32 NumRooms = 0;
+	Reader << Magic;
+	Reader << Version;
+	Reader << FileConfigHash;
+	Reader << FileSeed;
+	Reader << NumRooms;
+
+	if (Reader.IsError() || Magic != FileMagic || Version != FormatVersion)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[LayoutCache] %s is not a version %u layout file - solving a new layout"), *FilePath, FormatVersion);
+		return false;
+	}
+	if (FileConfigHash != ConfigHash || FileSeed != Seed)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[LayoutCache] Cached layout was solved with other settings (hash %08x seed %d, want %08x seed %d)"),
+			FileConfigHash, FileSeed, ConfigHash, Seed);
+		return false;
+	}
+
+	// Every room record is larger than this, so a corrupt count cannot trigger a huge allocation
+	const int64 MinRoomBytes = 32;
+	if (NumRooms <= 0 || NumRooms > (Bytes.Num() - Reader.Tell()) / MinRoomBytes)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[LayoutCache] %s has an invalid room count %d"), *FilePath, NumRooms);
+		return false;
+	}
+
+	OutRooms.SetNum(NumRooms);
+	for (FRoomData& Room : OutRooms)
+	{
+		SerializeRoom(Reader, Room);
+	}
+
+	// Connections must point at rooms of this layout, which is rebased on its initial room
+	bool bValid = !Reader.IsError() && Reader.AtEnd() && OutRooms[0].RoomIndex == 0;
+	TSet<int32> RoomIndices;
+	RoomIndices.Reserve(OutRooms.Num());
+	for (const FRoomData& Room : OutRooms)
+	{
+		RoomIndices.Add(Room.RoomIndex);
+	}
+	for (int32 RoomArrayIndex = 0; bValid && RoomArrayIndex < OutRooms.Num(); RoomArrayIndex++)
+	{
+		for (const FRoomConnection& Connection : OutRooms[RoomArrayIndex].Connections)
+		{
+			if (Connection.ConnectedRoomIndex != -1 && !RoomIndices.Contains(Connection.ConnectedRoomIndex))
+			{
+				bValid = false;
+				break;
+			}
+		}
+	}
+	if (!bValid)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[LayoutCache] %s is truncated or corrupt - solving a new layout"), *FilePath);
+		OutRooms.Reset();
+		return false;
+	}
+
+	for (FRoomData& Room : OutRooms)
+	{
+		OffsetRoom(Room, Origin);
+	}
+
+	LastFileBytes = Bytes.Num();
+	LastSeconds = FPlatformTime::Seconds() - StartTime;
+	return true;
+}
+
+bool FLayoutCache::SaveLayout(const FString& FilePath, uint32 ConfigHash, int32 Seed, const TArray<FRoomData>& Rooms)
+{
+	LastFileBytes = 0;
+	LastSeconds = 0.0;
+	if (Rooms.Num() == 0)
+	{
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	uint32 Magic = FileMagic;
+	uint32 Version = FormatVersion;
+	int32 NumRooms = Rooms.Num();
+	Writer << Magic;
+	Writer << Version;
+	Writer << ConfigHash;
+	Writer << Seed;
+	Writer << NumRooms;
+
+	// Relative to the initial room, so the layout can be rebuilt around another player start
+	const FVector Origin = Rooms[0].Position;
+	for (const FRoomData& Room : Rooms)
+	{
+		FRoomData Record = Room;
+		OffsetRoom(Record, -Origin);
+		SerializeRoom(Writer, Record);
+	}
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+	if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[LayoutCache] Failed to write %s"), *FilePath);
+		return false;
+	}
+
+	LastFileBytes = Bytes.Num();
+	LastSeconds = FPlatformTime::Seconds() - StartTime;
+	return true;
+}
+
+void FLayoutCache::GetCacheStats(int64& OutFileBytes, double& OutSeconds) const
+{
+	OutFileBytes = LastFileBytes;
+	OutSeconds = LastSeconds;
+}
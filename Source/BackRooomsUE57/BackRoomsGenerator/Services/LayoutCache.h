@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ILayoutCache.h"
+
+/**
+ * Standard implementation of the layout cache
+ * The file is a fixed header (magic, format version, config hash, seed, room count) followed by packed rooms;
+ * positions keep full precision so wall seams and shared walls resolve exactly as in the solved layout.
+ *
+ * Features:
+ * - Enums are stored as single bytes, connections as one count byte plus packed records
+ * - Positions are relative to the initial room and rebased on the caller's origin when loaded
+ * - Any mismatch or truncated file is rejected as a miss instead of a partial layout
+ * - Door configs are not stored - the connection manager derives them from each connection's type and width
+ */
+class FLayoutCache : public ILayoutCache
+{
+public:
+    /**
+     * Constructor - Service is standalone and uses UE_LOG for debugging
+     */
+    FLayoutCache();
+
+    // ILayoutCache interface
+    virtual bool LoadLayout(const FString& FilePath, uint32 ConfigHash, int32 Seed, const FVector& Origin, TArray<FRoomData>& OutRooms) override;
+
+    virtual bool SaveLayout(const FString& FilePath, uint32 ConfigHash, int32 Seed, const TArray<FRoomData>& Rooms) override;
+
+    virtual void GetCacheStats(int64& OutFileBytes, double& OutSeconds) const override;
+
+private:
+    // 'BRLY' - identifies a layout file
+    static constexpr uint32 FileMagic = 0x594C5242;
+
+    // Bump whenever the room or connection record (or the meaning of a field) changes - 3: stair elevations in meters
+    static constexpr uint32 FormatVersion = 3;
+
+    // Read or write one room (the archive's direction decides which)
+    static void SerializeRoom(FArchive& Ar, FRoomData& Room);
+
+    // Move a room and its connection points (stored positions are relative to the initial room)
+    static void OffsetRoom(FRoomData& Room, const FVector& Offset);
+
+    int64 LastFileBytes = 0;
+    double LastSeconds = 0.0;
+};
@@ -12,7 +12,7 @@ bool FRoomConnectionManager::TryPlaceRoom(const FRoomData& SourceRoom,
                                           const TArray<FRoomData>& ExistingRooms,
                                           const FBackroomGenerationConfig& Config,
                                           ICollisionDetectionService* CollisionService,
-                                          TFunction<void(FRoomData&)> RoomCreator)
+                                          TFunction<void(FRoomData&, const FRoomData&)> RoomCreator)
 {
     LogDebug(FString::Printf(TEXT("[DEBUG] TryPlaceRoom: Room %d (%.1fx%.1fm, Cat=%s, Elev=%.1fm) at Connection %d"), 
         NewRoom.RoomIndex, NewRoom.Width, NewRoom.Length, 
@@ -42,7 +42,7 @@ bool FRoomConnectionManager::TryPlaceRoom(const FRoomData& SourceRoom,
         // Call the room creator function (handles UE-specific room unit creation)
         if (RoomCreator)
         {
-            RoomCreator(NewRoom);
+            RoomCreator(NewRoom, SourceRoom);
         }
         
         return true; // Successfully placed
@@ -93,6 +93,19 @@ void FRoomConnectionManager::ConnectRooms(FRoomData& Room1,
         *UEnum::GetValueAsString(ConnectionType), ConnectionWidth), Config);
 }
 
+void FRoomConnectionManager::RebuildPhysicalConnections(FRoomData& Room)
+{
+    // Same hole ConnectRooms cut on this side - type and width were stored with the connection
+    for (int32 ConnectionIndex = 0; ConnectionIndex < Room.Connections.Num(); ConnectionIndex++)
+    {
+        const FRoomConnection& Connection = Room.Connections[ConnectionIndex];
+        if (Connection.bIsUsed && Connection.ConnectedRoomIndex >= 0)
+        {
+            CreatePhysicalConnection(Room, ConnectionIndex, Connection.ConnectionType, Connection.ConnectionWidth);
+        }
+    }
+}
+
 void FRoomConnectionManager::CreateRoomConnections(FRoomData& Room,
                                                    const FBackroomGenerationConfig& Config)
 {
@@ -300,7 +313,10 @@ void FRoomConnectionManager::DetermineConnectionProperties(const FRoomData& Room
                                                            float& OutConnectionWidth) const
 {
     // Determine connection type: use configured ratio
-    FRandomStream Random(FDateTime::Now().GetTicks());
+    // A seeded layout derives the stream from the seed and the two rooms, so the same seed cuts the same connections
+    FRandomStream Random(Config.LayoutSeed != 0
+        ? int32(HashCombine(HashCombine(uint32(Config.LayoutSeed), uint32(Room1.RoomIndex)), uint32(Room2.RoomIndex)))
+        : FDateTime::Now().GetTicks());
     OutConnectionType = (Random.FRand() < Config.DoorwayConnectionRatio) ? 
         EConnectionType::Doorway : EConnectionType::Opening;
     
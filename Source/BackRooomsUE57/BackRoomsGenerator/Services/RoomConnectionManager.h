@@ -32,7 +32,7 @@ public:
                              const TArray<FRoomData>& ExistingRooms,
                              const FBackroomGenerationConfig& Config,
                              ICollisionDetectionService* CollisionService,
-                             TFunction<void(FRoomData&)> RoomCreator) override;
+                             TFunction<void(FRoomData&, const FRoomData&)> RoomCreator) override;
     
     virtual void ConnectRooms(FRoomData& Room1, 
                              int32 Connection1Index, 
@@ -40,6 +40,8 @@ public:
                              int32 Connection2Index,
                              const FBackroomGenerationConfig& Config) override;
     
+    virtual void RebuildPhysicalConnections(FRoomData& Room) override;
+    
     virtual void CreateRoomConnections(FRoomData& Room,
                                       const FBackroomGenerationConfig& Config) override;
     
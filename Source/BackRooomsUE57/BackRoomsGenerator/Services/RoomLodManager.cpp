@@ -0,0 +1,204 @@
+#include "RoomLodManager.h"
+
+#include "GameFramework/Actor.h"
+#include "ProceduralMeshComponent.h"
+#include "Containers/Queue.h"
+
+namespace
+{
+	// Rooms switch back to full detail only once they are this much closer than the proxy distance
+	constexpr float LodHysteresis = 0.9f;
+}
+
+FRoomLodManager::FRoomLodManager() {}
+
+void FRoomLodManager::Initialize()
+{
+	// Drop proxies from any previous layout (detail actors belong to their rooms)
+	for (TPair<int32, FLodRoom>& Pair : Rooms)
+	{
+		if (AActor* ProxyActor = Pair.Value.ProxyActor.Get())
+		{
+			ProxyActor->Destroy();
+		}
+	}
+	Rooms.Empty();
+}
+
+void FRoomLodManager::RegisterRoom(int32 RoomIndex, const FBox& Bounds, const TArray<int32>& ConnectedRooms,
+                                   AActor* ProxyActor, const TArray<AActor*>& DetailActors)
+{
+	FLodRoom& Room = Rooms.FindOrAdd(RoomIndex);
+
+	// Re-registration: the old proxy is replaced and the old detail actors are shown again
+	SetShowProxy(Room, false);
+	if (AActor* OldProxy = Room.ProxyActor.Get())
+	{
+		if (OldProxy != ProxyActor)
+		{
+			OldProxy->Destroy();
+		}
+	}
+
+	Room.Bounds = Bounds;
+	Room.ConnectedRooms = ConnectedRooms;
+	Room.ProxyActor = ProxyActor;
+	Room.DetailActors.Reset(DetailActors.Num());
+	Room.DetailTriangles = 0;
+	for (AActor* DetailActor : DetailActors)
+	{
+		if (DetailActor)
+		{
+			Room.DetailActors.Add(DetailActor);
+			Room.DetailTriangles += CountTriangles(DetailActor);
+		}
+	}
+	Room.ProxyTriangles = CountTriangles(ProxyActor);
+	Room.bShowingProxy = false;
+
+	if (ProxyActor)
+	{
+		ProxyActor->SetActorHiddenInGame(true);
+	}
+}
+
+int32 FRoomLodManager::UpdateLod(const FVector& ViewerLocation, ERoomLodMetric Metric, float ProxyDistanceCm, int32 ProxyHops)
+{
+	TMap<int32, int32> Hops;
+	if (Metric == ERoomLodMetric::GraphHops)
+	{
+		ComputeHops(ViewerLocation, Hops);
+	}
+
+	int32 Swaps = 0;
+	for (TPair<int32, FLodRoom>& Pair : Rooms)
+	{
+		FLodRoom& Room = Pair.Value;
+		if (!Room.ProxyActor.IsValid())
+		{
+			continue;
+		}
+
+		bool bWantProxy;
+		if (Metric == ERoomLodMetric::GraphHops)
+		{
+			// Rooms not connected to the viewer's room at all are always proxies
+			const int32* RoomHops = Hops.Find(Pair.Key);
+			bWantProxy = !RoomHops || *RoomHops > ProxyHops;
+		}
+		else
+		{
+			const float Distance = FMath::Sqrt(Room.Bounds.ComputeSquaredDistanceToPoint(ViewerLocation));
+			const float Threshold = Room.bShowingProxy ? ProxyDistanceCm * LodHysteresis : ProxyDistanceCm;
+			bWantProxy = Distance > Threshold;
+		}
+
+		if (bWantProxy != Room.bShowingProxy)
+		{
+			SetShowProxy(Room, bWantProxy);
+			Swaps++;
+		}
+	}
+	return Swaps;
+}
+
+void FRoomLodManager::ComputeHops(const FVector& ViewerLocation, TMap<int32, int32>& OutHops) const
+{
+	// Start from the room containing the viewer, or the nearest one when standing outside every room
+	int32 StartRoom = INDEX_NONE;
+	float BestDistanceSquared = TNumericLimits<float>::Max();
+	for (const TPair<int32, FLodRoom>& Pair : Rooms)
+	{
+		const float DistanceSquared = Pair.Value.Bounds.ComputeSquaredDistanceToPoint(ViewerLocation);
+		if (DistanceSquared < BestDistanceSquared)
+		{
+			BestDistanceSquared = DistanceSquared;
+			StartRoom = Pair.Key;
+		}
+	}
+	if (StartRoom == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Breadth-first over room connections
+	TQueue<int32> Frontier;
+	OutHops.Add(StartRoom, 0);
+	Frontier.Enqueue(StartRoom);
+	int32 RoomIndex;
+	while (Frontier.Dequeue(RoomIndex))
+	{
+		const FLodRoom* Room = Rooms.Find(RoomIndex);
+		if (!Room)
+		{
+			continue;
+		}
+		const int32 NextHops = OutHops[RoomIndex] + 1;
+		for (int32 ConnectedRoom : Room->ConnectedRooms)
+		{
+			if (!OutHops.Contains(ConnectedRoom))
+			{
+				OutHops.Add(ConnectedRoom, NextHops);
+				Frontier.Enqueue(ConnectedRoom);
+			}
+		}
+	}
+}
+
+void FRoomLodManager::SetShowProxy(FLodRoom& Room, bool bShowProxy)
+{
+	// Hidden actors keep their collision, so a proxied room is still solid
+	for (const TWeakObjectPtr<AActor>& DetailActor : Room.DetailActors)
+	{
+		if (AActor* Actor = DetailActor.Get())
+		{
+			Actor->SetActorHiddenInGame(bShowProxy);
+		}
+	}
+	if (AActor* ProxyActor = Room.ProxyActor.Get())
+	{
+		ProxyActor->SetActorHiddenInGame(!bShowProxy);
+	}
+	Room.bShowingProxy = bShowProxy;
+}
+
+int32 FRoomLodManager::CountTriangles(const AActor* Actor)
+{
+	if (!Actor)
+	{
+		return 0;
+	}
+
+	int32 Triangles = 0;
+	TArray<UProceduralMeshComponent*> MeshComponents;
+	Actor->GetComponents(MeshComponents);
+	for (UProceduralMeshComponent* MeshComponent : MeshComponents)
+	{
+		for (int32 SectionIndex = 0; SectionIndex < MeshComponent->GetNumSections(); SectionIndex++)
+		{
+			if (const FProcMeshSection* Section = MeshComponent->GetProcMeshSection(SectionIndex))
+			{
+				Triangles += Section->ProcIndexBuffer.Num() / 3;
+			}
+		}
+	}
+	return Triangles;
+}
+
+void FRoomLodManager::GetLodStats(int32& OutRooms, int32& OutProxyRooms, int32& OutDrawnTriangles, int32& OutFullTriangles) const
+{
+	OutRooms = Rooms.Num();
+	OutProxyRooms = 0;
+	OutDrawnTriangles = 0;
+	OutFullTriangles = 0;
+	for (const TPair<int32, FLodRoom>& Pair : Rooms)
+	{
+		const FLodRoom& Room = Pair.Value;
+		OutFullTriangles += Room.DetailTriangles;
+		OutDrawnTriangles += Room.bShowingProxy ? Room.ProxyTriangles : Room.DetailTriangles;
+		if (Room.bShowingProxy)
+		{
+			OutProxyRooms++;
+		}
+	}
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IRoomLodManager.h"
+
+/**
+ * Standard implementation of room level of detail
+ * Swaps by hiding actors, so collision of full-detail actors stays in place while a room is a proxy
+ *
+ * Features:
+ * - Distance metric uses a small hysteresis band so rooms at the threshold do not flicker
+ * - Graph-hop metric runs a breadth-first search from the room the viewer stands in
+ * - Falls back to the nearest room when the viewer is outside every room
+ */
+class FRoomLodManager : public IRoomLodManager
+{
+public:
+    /**
+     * Constructor - Service is standalone and uses UE_LOG for debugging
+     */
+    FRoomLodManager();
+
+    // IRoomLodManager interface
+    virtual void Initialize() override;
+
+    virtual void RegisterRoom(int32 RoomIndex, const FBox& Bounds, const TArray<int32>& ConnectedRooms,
+                              AActor* ProxyActor, const TArray<AActor*>& DetailActors) override;
+
+    virtual int32 UpdateLod(const FVector& ViewerLocation, ERoomLodMetric Metric, float ProxyDistanceCm, int32 ProxyHops) override;
+
+    virtual void GetLodStats(int32& OutRooms, int32& OutProxyRooms, int32& OutDrawnTriangles, int32& OutFullTriangles) const override;
+
+private:
+    struct FLodRoom
+    {
+        FBox Bounds;
+        TArray<int32> ConnectedRooms;
+        TWeakObjectPtr<AActor> ProxyActor;
+        TArray<TWeakObjectPtr<AActor>> DetailActors;
+        int32 DetailTriangles = 0;
+        int32 ProxyTriangles = 0;
+        bool bShowingProxy = false;
+    };
+
+    TMap<int32, FLodRoom> Rooms;
+
+    /**
+     * Hop count from the viewer's room to every reachable room (unreachable rooms are absent)
+     */
+    void ComputeHops(const FVector& ViewerLocation, TMap<int32, int32>& OutHops) const;
+
+    /**
+     * Show either the proxy or the detail actors of a room
+     */
+    static void SetShowProxy(FLodRoom& Room, bool bShowProxy);
+
+    /**
+     * Triangles in the procedural mesh sections of an actor
+     */
+    static int32 CountTriangles(const AActor* Actor);
+};
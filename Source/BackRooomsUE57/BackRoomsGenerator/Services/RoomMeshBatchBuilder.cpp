@@ -0,0 +1,102 @@
+#include "RoomMeshBatchBuilder.h"
+
+#include "../WallUnit/WallGeometryCache.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformTime.h"
+
+FRoomMeshBatchBuilder::FRoomMeshBatchBuilder() {}
+
+void FRoomMeshBatchBuilder::Initialize()
+{
+	PendingWalls.Empty();
+	BatchCount = 0;
+	BuiltWallCount = 0;
+	BuildSeconds = 0.0;
+	SubmitSeconds = 0.0;
+}
+
+void FRoomMeshBatchBuilder::QueueWall(const UObject* Room, int32 SurfaceIndex, const FVector& Position, const FRotator& Rotation,
+                                      float WallWidth, float WallHeight, float WallThickness, const FResolvedHole* Hole,
+                                      FSubmitWallMesh&& Submit)
+{
+	// Replaces a pending build of the same surface - only the final version of a wall is built
+	FPendingWall& Wall = PendingWalls.FindOrAdd(FSurfaceKey(Room, SurfaceIndex));
+	Wall.Position = Position;
+	Wall.Rotation = Rotation;
+	Wall.WallWidth = WallWidth;
+	Wall.WallHeight = WallHeight;
+	Wall.WallThickness = WallThickness;
+	Wall.bHasHole = Hole != nullptr;
+	Wall.Hole = Hole ? *Hole : FResolvedHole();
+	Wall.Submit = MoveTemp(Submit);
+}
+
+bool FRoomMeshBatchBuilder::CancelWall(const UObject* Room, int32 SurfaceIndex)
+{
+	return PendingWalls.Remove(FSurfaceKey(Room, SurfaceIndex)) > 0;
+}
+
+int32 FRoomMeshBatchBuilder::BuildAndSubmit()
+{
+	check(IsInGameThread());
+	if (PendingWalls.Num() == 0)
+	{
+		return 0;
+	}
+
+	// Take the batch so a submit callback may queue walls for the next one
+	TMap<FSurfaceKey, FPendingWall> Batch = MoveTemp(PendingWalls);
+	PendingWalls.Reset();
+
+	TArray<FPendingWall*> Work;
+	Work.Reserve(Batch.Num());
+	for (TPair<FSurfaceKey, FPendingWall>& Pair : Batch)
+	{
+		Work.Add(&Pair.Value);
+	}
+
+	// Build phase: the geometry cache is lock-protected, everything else is per-wall state
+	const double BuildStart = FPlatformTime::Seconds();
+	ParallelFor(Work.Num(), [&Work](int32 Index)
+	{
+		FPendingWall& Wall = *Work[Index];
+		FWallGeometryRef Geometry = UWallGeometryCache::FindOrBuild(Wall.WallWidth, Wall.WallHeight, Wall.WallThickness,
+		                                                            Wall.bHasHole ? &Wall.Hole : nullptr);
+		UWallGeometryCache::ApplyTransform(*Geometry, Wall.Position, Wall.Rotation,
+		                                   Wall.Vertices, Wall.Triangles, Wall.Normals, Wall.UVs);
+		UWallGeometryCache::TransformCollision(*Geometry, Wall.Position, Wall.Rotation, Wall.CollisionHulls);
+	});
+	const double BuildTime = FPlatformTime::Seconds() - BuildStart;
+
+	// Submit phase: components and mesh sections are created on the game thread only
+	const double SubmitStart = FPlatformTime::Seconds();
+	for (FPendingWall* Wall : Work)
+	{
+		if (Wall->Submit)
+		{
+			Wall->Submit(MoveTemp(Wall->Vertices), MoveTemp(Wall->Triangles), MoveTemp(Wall->Normals), MoveTemp(Wall->UVs),
+			             MoveTemp(Wall->CollisionHulls));
+		}
+	}
+	const double SubmitTime = FPlatformTime::Seconds() - SubmitStart;
+
+	const int32 Submitted = Work.Num();
+
+	BatchCount++;
+	BuiltWallCount += Submitted;
+	BuildSeconds += BuildTime;
+	SubmitSeconds += SubmitTime;
+
+	UE_LOG(LogTemp, Log, TEXT("[RoomMeshBatchBuilder] Built %d walls in %.2f ms on %d worker threads, submitted in %.2f ms"),
+	       Submitted, BuildTime * 1000.0, FTaskGraphInterface::Get().GetNumWorkerThreads(), SubmitTime * 1000.0);
+	return Submitted;
+}
+
+void FRoomMeshBatchBuilder::GetBatchStats(int32& OutBatches, int32& OutWalls, double& OutBuildSeconds, double& OutSubmitSeconds) const
+{
+	OutBatches = BatchCount;
+	OutWalls = BuiltWallCount;
+	OutBuildSeconds = BuildSeconds;
+	OutSubmitSeconds = SubmitSeconds;
+}
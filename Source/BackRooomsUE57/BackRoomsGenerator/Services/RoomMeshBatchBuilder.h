@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IRoomMeshBatchBuilder.h"
+
+/**
+ * Standard implementation of batched room mesh building
+ * Builds queued walls with ParallelFor through the shared wall geometry cache
+ *
+ * Features:
+ * - Re-queuing a surface replaces its pending build, so walls re-cut by connections are built once
+ * - Worker threads only touch the geometry cache and their own output buffers
+ * - Submission starts only after every worker has finished, on the thread that called BuildAndSubmit
+ */
+class FRoomMeshBatchBuilder : public IRoomMeshBatchBuilder
+{
+public:
+    /**
+     * Constructor - Service is standalone and uses UE_LOG for debugging
+     */
+    FRoomMeshBatchBuilder();
+
+    // IRoomMeshBatchBuilder interface
+    virtual void Initialize() override;
+
+    virtual void QueueWall(const UObject* Room, int32 SurfaceIndex, const FVector& Position, const FRotator& Rotation,
+                           float WallWidth, float WallHeight, float WallThickness, const FResolvedHole* Hole,
+                           FSubmitWallMesh&& Submit) override;
+
+    virtual bool CancelWall(const UObject* Room, int32 SurfaceIndex) override;
+
+    virtual int32 BuildAndSubmit() override;
+
+    virtual void GetBatchStats(int32& OutBatches, int32& OutWalls, double& OutBuildSeconds, double& OutSubmitSeconds) const override;
+
+private:
+    typedef TPair<const UObject*, int32> FSurfaceKey;
+
+    // One queued wall; the mesh buffers are filled by a worker thread
+    struct FPendingWall
+    {
+        FVector Position;
+        FRotator Rotation;
+        float WallWidth = 0.0f;
+        float WallHeight = 0.0f;
+        float WallThickness = 0.0f;
+        bool bHasHole = false;
+        FResolvedHole Hole;
+        FSubmitWallMesh Submit;
+
+        TArray<FVector> Vertices;
+        TArray<int32> Triangles;
+        TArray<FVector> Normals;
+        TArray<FVector2D> UVs;
+        TArray<TArray<FVector>> CollisionHulls;
+    };
+
+    TMap<FSurfaceKey, FPendingWall> PendingWalls;
+    int32 BatchCount = 0;
+    int32 BuiltWallCount = 0;
+    double BuildSeconds = 0.0;
+    double SubmitSeconds = 0.0;
+};
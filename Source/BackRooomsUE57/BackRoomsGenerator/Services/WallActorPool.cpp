@@ -0,0 +1,74 @@
+#include "WallActorPool.h"
+
+#include "../WallUnit/WallUnit.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "ProceduralMeshComponent.h"
+
+FWallActorPool::FWallActorPool() {}
+
+void FWallActorPool::Initialize()
+{
+	// Drop parked actors from any previous layout (walls in use belong to their rooms)
+	for (const TWeakObjectPtr<AActor>& ParkedActor : ParkedActors)
+	{
+		if (AActor* Actor = ParkedActor.Get())
+		{
+			Actor->Destroy();
+		}
+	}
+	ParkedActors.Empty();
+	NumSpawned = 0;
+	NumReused = 0;
+	NumReleased = 0;
+}
+
+AActor* FWallActorPool::Acquire(UWorld* World, bool bAsyncCooking)
+{
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	while (ParkedActors.Num() > 0)
+	{
+		AActor* Actor = ParkedActors.Pop(EAllowShrinking::No).Get();
+		UProceduralMeshComponent* WallMesh = Actor ? Cast<UProceduralMeshComponent>(Actor->GetRootComponent()) : nullptr;
+		if (!IsValid(Actor) || !WallMesh || Actor->GetWorld() != World)
+		{
+			continue;
+		}
+
+		// The caller replaces the stale section before the next frame is drawn
+		WallMesh->bUseAsyncCooking = bAsyncCooking;
+		Actor->SetActorEnableCollision(true);
+		Actor->SetActorHiddenInGame(false);
+		NumReused++;
+		return Actor;
+	}
+
+	NumSpawned++;
+	return UWallUnit::SpawnWallActor(World, bAsyncCooking);
+}
+
+void FWallActorPool::Release(AActor* WallActor)
+{
+	if (!IsValid(WallActor))
+	{
+		return;
+	}
+
+	// Hidden actors still block, so collision goes off too
+	WallActor->SetActorHiddenInGame(true);
+	WallActor->SetActorEnableCollision(false);
+	ParkedActors.Add(WallActor);
+	NumReleased++;
+}
+
+void FWallActorPool::GetPoolStats(int32& OutSpawned, int32& OutReused, int32& OutReleased, int32& OutParked) const
+{
+	OutSpawned = NumSpawned;
+	OutReused = NumReused;
+	OutReleased = NumReleased;
+	OutParked = ParkedActors.Num();
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IWallActorPool.h"
+
+/**
+ * Standard implementation of the wall actor pool
+ * Parked actors keep their component, section and material; only visibility and collision are switched off,
+ * so reusing one costs a single section replacement instead of a spawn, a component registration and a destroy.
+ *
+ * Features:
+ * - Last released is first reused, so re-cutting a wall gets its own actor back
+ * - Actors are held weakly; anything destroyed elsewhere simply drops out of the pool
+ */
+class FWallActorPool : public IWallActorPool
+{
+public:
+    /**
+     * Constructor - Service is standalone and uses UE_LOG for debugging
+     */
+    FWallActorPool();
+
+    // IWallActorPool interface
+    virtual void Initialize() override;
+
+    virtual AActor* Acquire(UWorld* World, bool bAsyncCooking) override;
+
+    virtual void Release(AActor* WallActor) override;
+
+    virtual void GetPoolStats(int32& OutSpawned, int32& OutReused, int32& OutReleased, int32& OutParked) const override;
+
+private:
+    TArray<TWeakObjectPtr<AActor>> ParkedActors;
+
+    int32 NumSpawned = 0;
+    int32 NumReused = 0;
+    int32 NumReleased = 0;
+};
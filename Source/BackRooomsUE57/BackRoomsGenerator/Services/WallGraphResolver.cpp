@@ -0,0 +1,219 @@
+#include "WallGraphResolver.h"
+
+#include "../RoomUnit/StandardRoom.h"
+
+FWallGraphResolver::FWallGraphResolver() {}
+
+bool FWallGraphResolver::Covers(const FWallSegment& Outer, const FWallSegment& Inner)
+{
+	const float Tolerance = 1.0f; // 1cm
+	return Outer.SpanMin <= Inner.SpanMin + Tolerance && Outer.SpanMax >= Inner.SpanMax - Tolerance
+		&& Outer.BottomZ <= Inner.BottomZ + Tolerance && Outer.TopZ >= Inner.TopZ - Tolerance;
+}
+
+void FWallGraphResolver::AddSeamOpening(FOwnedSeam& Seam, const FWallSegment& Wall, const FDoorConfig& Opening)
+{
+	const bool bAlongX = (Wall.WallSide == EWallSide::North || Wall.WallSide == EWallSide::South);
+	const float WidthCm = MetersToUnrealUnits(Opening.Width);
+	float SpanMin = (Wall.SpanMin + Wall.SpanMax - WidthCm) * 0.5f;
+	float SpanMax = SpanMin + WidthCm;
+
+	if (!Seam.bHasOpening)
+	{
+		Seam.bHasOpening = true;
+		Seam.Opening = Opening;
+	}
+	else
+	{
+		// One hole over both openings (a doorway cut on both sides of the seam is usually the same one, slightly offset)
+		const float SeamSpanCenter = bAlongX ? Seam.OpeningCenter.X : Seam.OpeningCenter.Y;
+		const float SeamHalfWidthCm = MetersToUnrealUnits(Seam.Opening.Width) * 0.5f;
+		SpanMin = FMath::Min(SpanMin, SeamSpanCenter - SeamHalfWidthCm);
+		SpanMax = FMath::Max(SpanMax, SeamSpanCenter + SeamHalfWidthCm);
+		Seam.Opening.Width = (SpanMax - SpanMin) / 100.0f;
+		Seam.Opening.Height = FMath::Max(Seam.Opening.Height, Opening.Height);
+	}
+
+	const float SpanCenter = (SpanMin + SpanMax) * 0.5f;
+	Seam.OpeningCenter = bAlongX ? FVector(SpanCenter, Wall.Boundary, 0.0f) : FVector(Wall.Boundary, SpanCenter, 0.0f);
+}
+
+int32 FWallGraphResolver::ResolveSharedWalls(const TArray<FRoomData>& Rooms, float WallThickness)
+{
+	NumSeams = 0;
+	NumDroppedWalls = 0;
+	NumMergedOpenings = 0;
+
+	// Rooms are placed one wall thickness plus a 1cm anti-flicker gap apart; allow another cm of float drift
+	const float WallThicknessCm = MetersToUnrealUnits(WallThickness);
+	const float MaxGap = WallThicknessCm + 2.0f;
+	const float MinSeamThickness = WallThicknessCm * 0.5f;
+	checkf(MaxGap < CellSize, TEXT("Shared wall grid cells must be wider than the widest seam"));
+
+	// Every wall that may be shared, in world space
+	TArray<FWallSegment> Segments;
+	Segments.Reserve(Rooms.Num() * 4);
+	for (int32 RoomArrayIndex = 0; RoomArrayIndex < Rooms.Num(); RoomArrayIndex++)
+	{
+		const FRoomData& Room = Rooms[RoomArrayIndex];
+		if (!IsValid(Room.RoomUnit))
+		{
+			continue;
+		}
+
+		const float MinX = Room.Position.X;
+		const float MaxX = MinX + MetersToUnrealUnits(Room.Width);
+		const float MinY = Room.Position.Y;
+		const float MaxY = MinY + MetersToUnrealUnits(Room.Length);
+
+		for (EWallSide WallSide : { EWallSide::North, EWallSide::South, EWallSide::East, EWallSide::West })
+		{
+			FWallSegment Segment;
+			if (!Room.RoomUnit->CanShareWall(WallSide, Segment.Opening, Segment.bHasOpening))
+			{
+				continue;
+			}
+
+			Segment.RoomArrayIndex = RoomArrayIndex;
+			Segment.WallSide = WallSide;
+			Segment.BottomZ = Room.Position.Z;
+			Segment.TopZ = Room.Position.Z + MetersToUnrealUnits(Room.Height);
+			const bool bAlongX = (WallSide == EWallSide::North || WallSide == EWallSide::South);
+			Segment.SpanMin = bAlongX ? MinX : MinY;
+			Segment.SpanMax = bAlongX ? MaxX : MaxY;
+			switch (WallSide)
+			{
+				case EWallSide::North: Segment.Boundary = MaxY; break;
+				case EWallSide::South: Segment.Boundary = MinY; break;
+				case EWallSide::East:  Segment.Boundary = MaxX; break;
+				default:               Segment.Boundary = MinX; break;
+			}
+			Segments.Add(Segment);
+		}
+	}
+
+	// Spatial index: South and West walls by (seam axis, boundary cell); North and East walls look them up
+	auto GetCell = [](const FWallSegment& Segment, float Coordinate) -> FIntPoint {
+		const int32 Axis = (Segment.WallSide == EWallSide::North || Segment.WallSide == EWallSide::South) ? 0 : 1;
+		return FIntPoint(Axis, FMath::FloorToInt(Coordinate / CellSize));
+	};
+	TMultiMap<FIntPoint, int32> FarWallGrid;
+	for (int32 SegmentIndex = 0; SegmentIndex < Segments.Num(); SegmentIndex++)
+	{
+		const FWallSegment& Segment = Segments[SegmentIndex];
+		if (Segment.WallSide == EWallSide::South || Segment.WallSide == EWallSide::West)
+		{
+			FarWallGrid.Add(GetCell(Segment, Segment.Boundary), SegmentIndex);
+		}
+	}
+
+	// Seams on owner walls, and walls handed to an owner
+	TMap<int32, FOwnedSeam> OwnedSeams;
+	TSet<int32> DroppedSegments;
+	TArray<int32> Candidates;
+	for (int32 NearIndex = 0; NearIndex < Segments.Num(); NearIndex++)
+	{
+		const FWallSegment& Near = Segments[NearIndex];
+		if (Near.WallSide != EWallSide::North && Near.WallSide != EWallSide::East)
+		{
+			continue;
+		}
+
+		// A facing wall lies at most MaxGap beyond this one, so in this cell or the next
+		Candidates.Reset();
+		const FIntPoint Cell = GetCell(Near, Near.Boundary);
+		FarWallGrid.MultiFind(Cell, Candidates);
+		FarWallGrid.MultiFind(Cell + FIntPoint(0, 1), Candidates);
+		Candidates.Sort();
+
+		for (int32 FarIndex : Candidates)
+		{
+			const FWallSegment& Far = Segments[FarIndex];
+			const float Gap = Far.Boundary - Near.Boundary;
+			if (Far.RoomArrayIndex == Near.RoomArrayIndex || Gap < -1.0f || Gap > MaxGap)
+			{
+				continue;
+			}
+
+			// The wall covering the other owns the seam; equal walls go to the older room
+			const bool bNearCovers = Covers(Near, Far);
+			const bool bFarCovers = Covers(Far, Near);
+			int32 OwnerIndex;
+			int32 PartnerIndex;
+			if (bNearCovers && (!bFarCovers || Rooms[Near.RoomArrayIndex].RoomIndex <= Rooms[Far.RoomArrayIndex].RoomIndex))
+			{
+				OwnerIndex = NearIndex;
+				PartnerIndex = FarIndex;
+			}
+			else if (bFarCovers)
+			{
+				OwnerIndex = FarIndex;
+				PartnerIndex = NearIndex;
+			}
+			else
+			{
+				continue; // Partial overlap - both rooms keep their walls
+			}
+
+			if (DroppedSegments.Contains(OwnerIndex) || DroppedSegments.Contains(PartnerIndex) || OwnedSeams.Contains(PartnerIndex))
+			{
+				continue;
+			}
+
+			// One wall and one thickness per owner side
+			const float SeamThickness = FMath::Max(Gap, MinSeamThickness);
+			const FWallSegment& Owner = Segments[OwnerIndex];
+			const FWallSegment& Partner = Segments[PartnerIndex];
+			FOwnedSeam* Seam = OwnedSeams.Find(OwnerIndex);
+			if (Seam && FMath::Abs(Seam->Thickness - SeamThickness) > 1.0f)
+			{
+				continue;
+			}
+			if (!Seam)
+			{
+				// The owner's own opening stays centered on its wall, as when the wall is built alone
+				Seam = &OwnedSeams.Add(OwnerIndex);
+				Seam->Thickness = SeamThickness;
+				if (Owner.bHasOpening)
+				{
+					AddSeamOpening(*Seam, Owner, Owner.Opening);
+				}
+			}
+
+			// The neighbour's opening is cut where the neighbour's wall was - merged with any opening already on the seam
+			if (Partner.bHasOpening)
+			{
+				AddSeamOpening(*Seam, Partner, Partner.Opening);
+				NumMergedOpenings++;
+			}
+			DroppedSegments.Add(PartnerIndex);
+		}
+	}
+
+	// Hand the result to the rooms - they build it in BuildDeferredGeometry
+	for (int32 PartnerIndex : DroppedSegments)
+	{
+		const FWallSegment& Partner = Segments[PartnerIndex];
+		Rooms[Partner.RoomArrayIndex].RoomUnit->DropSharedWall(Partner.WallSide);
+	}
+	for (const TPair<int32, FOwnedSeam>& Seam : OwnedSeams)
+	{
+		const FWallSegment& OwnerWall = Segments[Seam.Key];
+		Rooms[OwnerWall.RoomArrayIndex].RoomUnit->OwnSharedWall(OwnerWall.WallSide, Seam.Value.Thickness / 100.0f,
+			Seam.Value.bHasOpening ? &Seam.Value.Opening : nullptr, Seam.Value.OpeningCenter);
+	}
+
+	NumSeams = OwnedSeams.Num();
+	NumDroppedWalls = DroppedSegments.Num();
+
+	UE_LOG(LogTemp, Log, TEXT("WallGraphResolver: %d candidate walls, %d seams, %d walls dropped, %d openings merged"),
+		Segments.Num(), NumSeams, NumDroppedWalls, NumMergedOpenings);
+	return NumSeams;
+}
+
+void FWallGraphResolver::GetGraphStats(int32& OutSeams, int32& OutDroppedWalls, int32& OutMergedOpenings) const
+{
+	OutSeams = NumSeams;
+	OutDroppedWalls = NumDroppedWalls;
+	OutMergedOpenings = NumMergedOpenings;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IWallGraphResolver.h"
+
+/**
+ * Standard implementation of the shared wall resolver
+ * Every candidate wall goes into a hash grid keyed by seam axis and quantized boundary coordinate,
+ * so each wall only tests the few walls in its own and the next cell instead of every other room.
+ *
+ * Features:
+ * - A seam is merged only when one wall fully covers the other (span and height); the covering wall owns it
+ * - The owner's wall fills the whole gap between both rooms and carries one hole over both rooms' openings
+ * - Walls that are removed or thickened by their connection keep their own build
+ */
+class FWallGraphResolver : public IWallGraphResolver
+{
+public:
+    /**
+     * Constructor - Service is standalone and uses UE_LOG for debugging
+     */
+    FWallGraphResolver();
+
+    // IWallGraphResolver interface
+    virtual int32 ResolveSharedWalls(const TArray<FRoomData>& Rooms, float WallThickness) override;
+
+    virtual void GetGraphStats(int32& OutSeams, int32& OutDroppedWalls, int32& OutMergedOpenings) const override;
+
+private:
+    // One side of one room in world space (cm)
+    struct FWallSegment
+    {
+        int32 RoomArrayIndex = INDEX_NONE;
+        EWallSide WallSide = EWallSide::None;
+        float Boundary = 0.0f;  // Room boundary coordinate across the seam (Y for North/South, X for East/West)
+        float SpanMin = 0.0f;   // Extent along the seam
+        float SpanMax = 0.0f;
+        float BottomZ = 0.0f;
+        float TopZ = 0.0f;
+        bool bHasOpening = false;
+        FDoorConfig Opening;
+    };
+
+    // Seam accumulated on an owner wall
+    struct FOwnedSeam
+    {
+        float Thickness = 0.0f;
+        bool bHasOpening = false;
+        FDoorConfig Opening;
+        FVector OpeningCenter = FVector::ZeroVector;
+    };
+
+    // Does Outer cover Inner along the seam and in height
+    static bool Covers(const FWallSegment& Outer, const FWallSegment& Inner);
+
+    // Add an opening centered on Wall to the seam; openings already on it are merged into one hole spanning all of them
+    static void AddSeamOpening(FOwnedSeam& Seam, const FWallSegment& Wall, const FDoorConfig& Opening);
+
+    // Grid cell size along the seam axis (cm) - larger than the widest seam, so a partner is in the same or next cell
+    static constexpr float CellSize = 50.0f;
+
+    int32 NumSeams = 0;
+    int32 NumDroppedWalls = 0;
+    int32 NumMergedOpenings = 0;
+};
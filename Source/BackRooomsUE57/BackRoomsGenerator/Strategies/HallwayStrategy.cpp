@@ -7,7 +7,7 @@ FRoomData FHallwayStrategy::GenerateRoom(const FBackroomGenerationConfig& Config
     InitializeBaseRoomData(Room, ERoomCategory::Hallway, RoomIndex, Config);
     
     // Generate random dimensions within hallway constraints
-    FRandomStream Random = CreateRandomStream(RoomIndex);
+    FRandomStream Random = CreateRandomStream(Config, RoomIndex);
     GenerateHallwayDimensions(Config, Random, Room.Width, Room.Length);
     
     // Create hallway connections
@@ -76,11 +76,16 @@ protected:
      * Utility function for random number generation with seed
      * Creates consistent randomization for testing and debugging
      * 
+     * @param Config - Generation configuration (a non-zero LayoutSeed makes the stream reproducible)
      * @param RoomIndex - Room index for seed variation
      * @return Initialized random stream
      */
-    FRandomStream CreateRandomStream(int32 RoomIndex) const
+    FRandomStream CreateRandomStream(const FBackroomGenerationConfig& Config, int32 RoomIndex) const
     {
+        if (Config.LayoutSeed != 0)
+        {
+            return FRandomStream(int32(HashCombine(uint32(Config.LayoutSeed), uint32(RoomIndex))));
+        }
         return FRandomStream(FDateTime::Now().GetTicks() + RoomIndex * 12345 + FMath::Rand());
     }
     
@@ -8,7 +8,7 @@ FRoomData FStairsStrategy::GenerateRoom(const FBackroomGenerationConfig& Config,
 	InitializeBaseRoomData(Room, ERoomCategory::Stairs, RoomIndex, Config);
 
 	// Generate random dimensions within stairs constraints
-	FRandomStream Random = CreateRandomStream(RoomIndex);
+	FRandomStream Random = CreateRandomStream(Config, RoomIndex);
 	GenerateStairsDimensions(Config, Random, Room.Width, Room.Length);
 
 	// Determine stair direction randomly for standalone generation
@@ -16,7 +16,7 @@ FRoomData FStairsStrategy::GenerateRoom(const FBackroomGenerationConfig& Config,
 	// Fix: Add bounds checking for array access
 	if (PossibleDirections.Num() > 0)
 	{
-		Room.StairDirection = PossibleDirections[FMath::RandRange(0, PossibleDirections.Num() - 1)];
+		Room.StairDirection = PossibleDirections[Random.RandRange(0, PossibleDirections.Num() - 1)];
 	}
 
 	// Calculate elevation change
@@ -38,7 +38,7 @@ FRoomData FStairsStrategy::GenerateConnectedRoom(const FBackroomGenerationConfig
 	FRoomData Room = GenerateRoom(Config, RoomIndex);
 
 	// For stairs, connection-aware generation considers source room elevation
-	FRandomStream Random = CreateRandomStream(RoomIndex);
+	FRandomStream Random = CreateRandomStream(Config, RoomIndex);
 
 	// Determine stair direction based on connection context
 	Room.StairDirection = DetermineStairDirection(SourceRoom, ConnectionIndex, Random);
@@ -184,12 +184,9 @@ float FStairsStrategy::CalculateStairElevation(const FBackroomGenerationConfig&
 	const float MinHeight = FMath::Max(1.0f, Config.MinStairHeight);
 	const float MaxHeight = FMath::Max(MinHeight + 0.5f, Config.MaxStairHeight);
 
-	// Calculate base elevation change
+	// Calculate base elevation change (meters, like every other room elevation)
 	float ElevationChange = Random.FRandRange(MinHeight, MaxHeight);
 
-	// Convert to Unreal units (centimeters)
-	ElevationChange = ElevationChange * 100.0f;
-
 	// Apply direction
 	if (!bGoingUp)
 	{
@@ -210,7 +207,7 @@ EWallSide FStairsStrategy::DetermineStairDirection(const FRoomData& SourceRoom,
 		// Fix: Add bounds checking for array access
 		if (PossibleDirections.Num() > 0)
 		{
-			return PossibleDirections[FMath::RandRange(0, PossibleDirections.Num() - 1)];
+			return PossibleDirections[Random.RandRange(0, PossibleDirections.Num() - 1)];
 		}
 		return EWallSide::North; // Safe fallback
 	}
@@ -236,7 +233,7 @@ EWallSide FStairsStrategy::DetermineStairDirection(const FRoomData& SourceRoom,
 		// Fix: Add bounds checking for array access
 		if (PossibleDirections.Num() > 0)
 		{
-			return PossibleDirections[FMath::RandRange(0, PossibleDirections.Num() - 1)];
+			return PossibleDirections[Random.RandRange(0, PossibleDirections.Num() - 1)];
 		}
 		return EWallSide::North; // Safe fallback
 	}
@@ -7,7 +7,7 @@ FRoomData FStandardRoomStrategy::GenerateRoom(const FBackroomGenerationConfig& C
     InitializeBaseRoomData(Room, ERoomCategory::Room, RoomIndex, Config);
     
     // Generate random dimensions within standard room constraints
-    FRandomStream Random = CreateRandomStream(RoomIndex);
+    FRandomStream Random = CreateRandomStream(Config, RoomIndex);
     GenerateStandardRoomDimensions(Config, Random, Room.Width, Room.Length);
     
     // Create standard room connections
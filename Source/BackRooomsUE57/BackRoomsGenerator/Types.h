@@ -236,6 +236,14 @@ enum class ERoomCategory : uint8
 	Stairs = 2 UMETA(DisplayName = "Stairs")     // Stair units (4-10m with vertical elevation)
 };
 
+// How distant rooms are chosen for their proxy LOD
+UENUM(BlueprintType)
+enum class ERoomLodMetric : uint8
+{
+	Distance = 0 UMETA(DisplayName = "Distance"),    // Distance from the viewer to the room bounds
+	GraphHops = 1 UMETA(DisplayName = "Graph Hops")  // Connections between the viewer's room and the room
+};
+
 // Connection type enumeration
 UENUM(BlueprintType)
 enum class EConnectionType : uint8
@@ -0,0 +1,219 @@
+#include "HoleDescriptor.h"
+
+namespace
+{
+	// Named polygon presets for FWallHoleConfig::HoleName (resolved once at compile time)
+	struct FHoleShapePreset
+	{
+		const TCHAR* Name;
+		int32 Points;
+		float Irregularity;
+		float Smoothness;
+		float Rotation;
+		int32 Seed;
+		bool bRandomRotation;
+	};
+
+	const FHoleShapePreset HoleShapePresets[] = {
+		{ TEXT("Circle"),   24, 0.0f, 1.0f, 0.0f,  12345, false }, // Fixed seed for consistent circles
+		{ TEXT("Triangle"),  3, 0.1f, 0.1f, 0.0f,  11111, false },
+		{ TEXT("Square"),    4, 0.0f, 0.2f, 45.0f, 22222, false }, // Diamond orientation
+		{ TEXT("Hexagon"),   6, 0.0f, 0.5f, 0.0f,  33333, false },
+		{ TEXT("Star"),      8, 0.5f, 0.1f, 22.5f, 44444, false }, // Slight rotation for star effect
+		{ TEXT("Flower"),   12, 0.4f, 0.8f, 15.0f, 55555, false },
+		{ TEXT("Blob"),     10, 0.8f, 0.9f, 0.0f,  66666, true },
+		{ TEXT("Crystal"),   6, 0.6f, 0.0f, 30.0f, 77777, false }
+	};
+
+	// Largest polygon radius that still leaves wall around the hole
+	float ClampPolygonSize(float SizeCm, float WallWidthCm, float WallHeightCm)
+	{
+		return FMath::Min(SizeCm, FMath::Min(WallWidthCm, WallHeightCm) * 0.95f);
+	}
+}
+
+FResolvedHole FResolvedHole::Compile(const FWallHoleConfig& HoleConfig, float WallWidth, float WallHeight)
+{
+	FResolvedHole Hole;
+
+	// Resolve position type string once
+	if (HoleConfig.PositionType == TEXT("default"))
+	{
+		Hole.PositionMode = EHolePositionMode::Default;
+	}
+	else if (HoleConfig.PositionType == TEXT("custom"))
+	{
+		Hole.PositionMode = EHolePositionMode::Custom;
+	}
+	else
+	{
+		Hole.PositionMode = EHolePositionMode::Normalized; // "normalized" or any other type
+	}
+
+	// Same rules as FWallHoleConfig::GetNormalizedPosition, driven by the resolved mode
+	float Horizontal, Vertical;
+	switch (Hole.PositionMode)
+	{
+		case EHolePositionMode::Default:
+			Horizontal = 0.5f;
+			Vertical = (WallHeight > 0.0f) ? (HoleConfig.Height * 0.5f) / WallHeight : 0.3f;
+			break;
+		case EHolePositionMode::Custom:
+			Horizontal = (WallWidth > 0.0f) ? HoleConfig.X / WallWidth : 0.5f;
+			Vertical = (WallHeight > 0.0f) ? HoleConfig.Y / WallHeight : 0.5f;
+			break;
+		default:
+			Horizontal = HoleConfig.HorizontalPosition;
+			Vertical = HoleConfig.VerticalPosition;
+			break;
+	}
+
+	const float WallWidthCm = MetersToUnrealUnits(WallWidth);
+	const float WallHeightCm = MetersToUnrealUnits(WallHeight);
+
+	Hole.WidthCm = MetersToUnrealUnits(HoleConfig.Width);
+	Hole.HeightCm = MetersToUnrealUnits(HoleConfig.Height);
+	Hole.CenterXCm = Horizontal * WallWidthCm;
+
+	if (HoleConfig.Shape == EHoleShape::Rectangle)
+	{
+		Hole.Shape = EHoleShape::Rectangle;
+		// VerticalPosition 0.0 = bottom-aligned: center at half the door height from bottom
+		Hole.CenterZCm = (Vertical == 0.0f) ? Hole.HeightCm * 0.5f : Vertical * WallHeightCm;
+		return Hole;
+	}
+
+	// Circles and irregular shapes both use the polygon system, centered vertically
+	Hole.Shape = EHoleShape::Irregular;
+	Hole.CenterZCm = WallHeightCm * 0.5f;
+	Hole.PolygonSizeCm = ClampPolygonSize(FMath::Max(Hole.WidthCm, Hole.HeightCm), WallWidthCm, WallHeightCm);
+
+	if (HoleConfig.Shape == EHoleShape::Circle)
+	{
+		Hole.PolygonPoints = 16; // Good performance/quality balance
+		Hole.Irregularity = 0.0f;
+		Hole.Smoothness = 1.0f;
+		Hole.RotationDeg = 0.0f;
+		Hole.Seed = 30000;
+		return Hole;
+	}
+
+	for (const FHoleShapePreset& Preset : HoleShapePresets)
+	{
+		if (HoleConfig.HoleName == Preset.Name)
+		{
+			Hole.PolygonPoints = Preset.Points;
+			Hole.Irregularity = Preset.Irregularity;
+			Hole.Smoothness = Preset.Smoothness;
+			Hole.RotationDeg = Preset.bRandomRotation ? FMath::RandRange(0.0f, 360.0f) : Preset.Rotation;
+			Hole.Seed = Preset.Seed;
+			return Hole;
+		}
+	}
+
+	// Default random irregular hole (for Row 6 random shapes)
+	Hole.PolygonPoints = 12;
+	Hole.Irregularity = 0.7f;
+	Hole.Smoothness = 0.3f;
+	Hole.RotationDeg = FMath::RandRange(0.0f, 360.0f);
+	Hole.Seed = FMath::RandRange(1000, 99999);
+	return Hole;
+}
+
+FResolvedHole FResolvedHole::Compile(const FDoorConfig& Door, float WallWidth, float WallHeight)
+{
+	FResolvedHole Hole;
+	Hole.PositionMode = EHolePositionMode::DoorOffset;
+
+	const float WallWidthCm = MetersToUnrealUnits(WallWidth);
+	const float WallHeightCm = MetersToUnrealUnits(WallHeight);
+
+	Hole.CenterXCm = (WallWidthCm * 0.5f) + MetersToUnrealUnits(Door.OffsetFromCenter);
+	Hole.WidthCm = MetersToUnrealUnits(Door.Width);
+	Hole.HeightCm = MetersToUnrealUnits(Door.Height);
+	Hole.Seed = Door.RandomSeed;
+
+	switch (Door.HoleShape)
+	{
+		case EHoleShape::Circle:
+			// Circular doors use a 24-point polygon for consistency with irregular holes
+			Hole.Shape = EHoleShape::Irregular;
+			Hole.CenterZCm = WallHeightCm * 0.5f;
+			Hole.PolygonSizeCm = ClampPolygonSize(MetersToUnrealUnits(Door.Radius * 2.0f), WallWidthCm, WallHeightCm);
+			Hole.PolygonPoints = 24;
+			Hole.Irregularity = 0.0f;
+			Hole.Smoothness = 1.0f;
+			Hole.RotationDeg = 0.0f;
+			break;
+
+		case EHoleShape::Irregular:
+			Hole.Shape = EHoleShape::Irregular;
+			Hole.CenterZCm = WallHeightCm * 0.5f;
+			Hole.PolygonSizeCm = ClampPolygonSize(MetersToUnrealUnits(Door.IrregularSize), WallWidthCm, WallHeightCm);
+			Hole.PolygonPoints = Door.IrregularPoints;
+			Hole.Irregularity = Door.Irregularity;
+			Hole.Smoothness = Door.IrregularSmoothness;
+			Hole.RotationDeg = Door.IrregularRotation;
+			break;
+
+		case EHoleShape::Rectangle:
+		default:
+			// Doors start at ground level (floor height)
+			Hole.Shape = EHoleShape::Rectangle;
+			Hole.CenterZCm = Hole.HeightCm * 0.5f;
+			break;
+	}
+
+	return Hole;
+}
+
+FResolvedHole FResolvedHole::MakeRectangle(float WallWidth, float WallHeight, float HoleWidth, float HoleHeight,
+	float HorizontalPosition, float VerticalPosition)
+{
+	FResolvedHole Hole;
+	Hole.Shape = EHoleShape::Rectangle;
+	Hole.PositionMode = EHolePositionMode::Normalized;
+	Hole.WidthCm = MetersToUnrealUnits(HoleWidth);
+	Hole.HeightCm = MetersToUnrealUnits(HoleHeight);
+	Hole.CenterXCm = HorizontalPosition * MetersToUnrealUnits(WallWidth);
+	Hole.CenterZCm = VerticalPosition * MetersToUnrealUnits(WallHeight);
+	return Hole;
+}
+
+bool FResolvedHole::operator==(const FResolvedHole& Other) const
+{
+	if (Shape != Other.Shape || CenterXCm != Other.CenterXCm || CenterZCm != Other.CenterZCm
+		|| WidthCm != Other.WidthCm || HeightCm != Other.HeightCm)
+	{
+		return false;
+	}
+
+	if (!IsPolygon())
+	{
+		return true;
+	}
+
+	return PolygonSizeCm == Other.PolygonSizeCm && PolygonPoints == Other.PolygonPoints
+		&& Irregularity == Other.Irregularity && Smoothness == Other.Smoothness
+		&& RotationDeg == Other.RotationDeg && Seed == Other.Seed;
+}
+
+uint32 GetTypeHash(const FResolvedHole& Hole)
+{
+	uint32 Hash = HashCombine(GetTypeHash(static_cast<uint8>(Hole.Shape)), GetTypeHash(Hole.CenterXCm));
+	Hash = HashCombine(Hash, GetTypeHash(Hole.CenterZCm));
+	Hash = HashCombine(Hash, GetTypeHash(Hole.WidthCm));
+	Hash = HashCombine(Hash, GetTypeHash(Hole.HeightCm));
+
+	if (!Hole.IsPolygon())
+	{
+		return Hash;
+	}
+
+	Hash = HashCombine(Hash, GetTypeHash(Hole.PolygonSizeCm));
+	Hash = HashCombine(Hash, GetTypeHash(Hole.PolygonPoints));
+	Hash = HashCombine(Hash, GetTypeHash(Hole.Irregularity));
+	Hash = HashCombine(Hash, GetTypeHash(Hole.Smoothness));
+	Hash = HashCombine(Hash, GetTypeHash(Hole.RotationDeg));
+	return HashCombine(Hash, GetTypeHash(Hole.Seed));
+}
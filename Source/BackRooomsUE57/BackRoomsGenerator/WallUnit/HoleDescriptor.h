@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../Types.h"
+
+// How the hole center was specified before it was resolved to centimeters
+enum class EHolePositionMode : uint8
+{
+	Default,    // FWallHoleConfig "default": centered horizontally, bottom-aligned
+	Custom,     // FWallHoleConfig "custom": cartesian X/Y in meters from bottom-left
+	Normalized, // FWallHoleConfig "normalized": 0.0-1.0 across the wall
+	DoorOffset  // FDoorConfig: horizontal OffsetFromCenter
+};
+
+/**
+ * Fully resolved hole description consumed by the mesh kernels
+ * FWallHoleConfig / FDoorConfig are compiled into this once per wall, so the geometry
+ * path never sees string compares, FString copies or meter conversions.
+ * All distances are in centimeters measured from the wall's bottom-left corner.
+ */
+struct FResolvedHole
+{
+	EHoleShape Shape = EHoleShape::Rectangle; // Rectangle or Irregular (circles resolve to polygons)
+	EHolePositionMode PositionMode = EHolePositionMode::Default;
+
+	// Hole center in wall space
+	float CenterXCm = 0.0f;
+	float CenterZCm = 0.0f;
+
+	// Rectangle extents
+	float WidthCm = 0.0f;
+	float HeightCm = 0.0f;
+
+	// Polygon parameters (Irregular only)
+	float PolygonSizeCm = 0.0f; // Base radius, already clamped to the wall
+	int32 PolygonPoints = 8;
+	float Irregularity = 0.0f;
+	float Smoothness = 0.0f;
+	float RotationDeg = 0.0f;
+	int32 Seed = 12345;
+
+	bool IsPolygon() const { return Shape == EHoleShape::Irregular; }
+
+	// Geometric equality (PositionMode is ignored - it doesn't change the mesh)
+	bool operator==(const FResolvedHole& Other) const;
+	friend uint32 GetTypeHash(const FResolvedHole& Hole);
+
+	// Compile advanced hole config (resolves PositionType and HoleName shape presets)
+	static FResolvedHole Compile(const FWallHoleConfig& HoleConfig, float WallWidth, float WallHeight);
+
+	// Compile door config (circle doors become 24-point polygons)
+	static FResolvedHole Compile(const FDoorConfig& Door, float WallWidth, float WallHeight);
+
+	// Rectangle from normalized hole-center coordinates (0.0-1.0)
+	static FResolvedHole MakeRectangle(float WallWidth, float WallHeight, float HoleWidth, float HoleHeight,
+		float HorizontalPosition, float VerticalPosition);
+};
@@ -1,40 +1,51 @@
 #include "HoleGenerator.h"
 #include "../Main.h"  // For log category
+#include "Algo/Reverse.h"
 
 void UHoleGenerator::GenerateWallWithHole(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
 	FVector InnerBL, FVector InnerBR, FVector InnerTR, FVector InnerTL,
 	FVector OuterBL, FVector OuterBR, FVector OuterTR, FVector OuterTL,
-	float WallWidth, float WallHeight, const FDoorConfig& Door, float WallThickness)
+	float WallWidth, float WallHeight, const FResolvedHole& Hole, float WallThickness)
 {
-	// Generate irregular polygon using random parameters
-	float BaseSizeCm = MetersToUnrealUnits(Door.IrregularSize);
-	float OffsetFromCenterCm = MetersToUnrealUnits(Door.OffsetFromCenter);
+	// Hole is pre-resolved: center and polygon size are already in cm and clamped to the wall
+	float BaseSizeCm = Hole.PolygonSizeCm;
 	float WallWidthCm = MetersToUnrealUnits(WallWidth);
 	float WallHeightCm = MetersToUnrealUnits(WallHeight);
 	
-	// Calculate hole center position
-	float WallCenterOffsetCm = (WallWidthCm * 0.5f) + OffsetFromCenterCm;
-	float HoleHeightCm = WallHeightCm * 0.5f; // Center vertically
+	// Hole center position
+	float WallCenterOffsetCm = Hole.CenterXCm;
+	float HoleHeightCm = Hole.CenterZCm;
 	
-	// Bounds checking - allow very large holes for testing
-	float MaxAllowableSize = FMath::Min(WallWidthCm, WallHeightCm) * 0.95f; // Max 95% of smallest wall dimension
-	if (BaseSizeCm > MaxAllowableSize)
+	// Generate irregular polygon points
+	TArray<FVector2D> IrregularPoints = GenerateIrregularPolygon(Hole);
+	
+	UE_LOG(LogBackRoomGenerator, Log, TEXT("Generated irregular hole with %d points, size=%.0fcm, irregularity=%.2f, seed=%d"), 
+		Hole.PolygonPoints, BaseSizeCm, Hole.Irregularity, Hole.Seed);
+	
+	// Exact path: triangulate the wall face around the polygon itself instead of tiling the wall with cells
+	TArray<FVector2D> WallSpaceHolePoints;
+	WallSpaceHolePoints.Reserve(IrregularPoints.Num());
+	for (const FVector2D& Point : IrregularPoints)
 	{
-		// UE_LOG(LogBackRoomGenerator, Warning, TEXT("Irregular hole size %.0fcm too large for wall %.0fx%.0fcm, clamping to %.0fcm"), 
-		//	BaseSizeCm, WallWidthCm, WallHeightCm, MaxAllowableSize);
-		BaseSizeCm = MaxAllowableSize;
+		WallSpaceHolePoints.Add(FVector2D(Point.X + WallCenterOffsetCm, Point.Y + HoleHeightCm));
 	}
 	
-	// Generate irregular polygon points
-	TArray<FVector2D> IrregularPoints = GenerateIrregularPolygon(Door, BaseSizeCm);
+	const int32 TrianglesBefore = Triangles.Num();
+	if (GenerateTriangulatedWallWithHole(Vertices, Triangles, Normals, UVs,
+		InnerBL, InnerBR, InnerTL, OuterBL, OuterBR, OuterTL,
+		WallWidthCm, WallHeightCm, WallSpaceHolePoints, WallThickness))
+	{
+		UE_LOG(LogBackRoomGenerator, Log, TEXT("Exact irregular hole: %d triangles for %d polygon points, seed %d"), 
+			(Triangles.Num() - TrianglesBefore) / 3, IrregularPoints.Num(), Hole.Seed);
+		return;
+	}
 	
-	UE_LOG(LogBackRoomGenerator, Log, TEXT("Generated irregular hole with %d points, size=%.0fcm, irregularity=%.2f, seed=%d"), 
-		Door.IrregularPoints, BaseSizeCm, Door.Irregularity, Door.RandomSeed);
+	UE_LOG(LogBackRoomGenerator, Log, TEXT("Irregular hole reaches the wall edge or self-intersects - using cell grid"));
 	
 	// OPTIMIZED: Use hole-based sizing with reasonable minimums for performance
 	// Segment size based on hole detail needs, not wall size
 	float SegmentSize;
-	if (Door.IrregularSmoothness >= 0.8f)
+	if (Hole.Smoothness >= 0.8f)
 	{
 		// Smooth holes: Smaller segments for detail, but not crazy small
 		SegmentSize = FMath::Max(BaseSizeCm * 0.1f, 15.0f); // Min 15cm for smooth holes
@@ -61,326 +72,749 @@ void UHoleGenerator::GenerateWallWithHole(TArray<FVector>& Vertices, TArray<int3
 	
 	int32 GeneratedSegments = 0;
 	
-	// Generate wall segments, skipping those that overlap the irregular polygon
-	for (int32 GridX = 0; GridX < GridXSize; GridX++)
+	// Rasterize the polygon once onto the cell test points (corners and centers), relative to the hole center
+	TArray<bool> CornerInHole, CenterInHole;
+	const int32 CornerCrossings = RasterizePolygonInside(IrregularPoints,
+		GridStartX - WallCenterOffsetCm, GridStartZ - HoleHeightCm, SegmentSize, GridXSize + 1, GridZSize + 1, CornerInHole);
+	const int32 CenterCrossings = RasterizePolygonInside(IrregularPoints,
+		GridStartX + (SegmentSize * 0.5f) - WallCenterOffsetCm, GridStartZ + (SegmentSize * 0.5f) - HoleHeightCm, SegmentSize, GridXSize, GridZSize, CenterInHole);
+	
+	UE_LOG(LogBackRoomGenerator, Log, TEXT("Hole occupancy: %d scanlines, %d edge crossings for %d cells (replaces %d point-in-polygon tests)"), 
+		(GridZSize + 1) + GridZSize, CornerCrossings + CenterCrossings, TotalGridCells, TotalGridCells * 5);
+	
+	// A grid cell is solid wall if it lies inside the grid, none of its corners or its center is inside the
+	// irregular polygon, and it is still at least 1cm on each side after clamping to the wall bounds
+	auto IsCellSolid = [&](int32 CellGridX, int32 CellGridZ) -> bool {
+		if (CellGridX < 0 || CellGridX >= GridXSize || CellGridZ < 0 || CellGridZ >= GridZSize)
+		{
+			return false;
+		}
+		
+		const int32 CornerStride = GridXSize + 1;
+		const int32 CornerIndex = (CellGridZ * CornerStride) + CellGridX;
+		if (CornerInHole[CornerIndex] || CornerInHole[CornerIndex + 1]
+			|| CornerInHole[CornerIndex + CornerStride] || CornerInHole[CornerIndex + CornerStride + 1]
+			|| CenterInHole[(CellGridZ * GridXSize) + CellGridX])
+		{
+			return false; // Cell overlaps the hole
+		}
+		
+		float SegStartX = GridStartX + (CellGridX * SegmentSize);
+		float SegEndX = SegStartX + SegmentSize;
+		float SegStartZ = GridStartZ + (CellGridZ * SegmentSize);
+		float SegEndZ = SegStartZ + SegmentSize;
+		
+		// Skip if segment becomes too small once clamped to the wall
+		return (FMath::Min(WallWidthCm, SegEndX) - FMath::Max(0.0f, SegStartX)) >= 1.0f
+			&& (FMath::Min(WallHeightCm, SegEndZ) - FMath::Max(0.0f, SegStartZ)) >= 1.0f;
+	};
+	
+	// Classify every cell once - greedy merging and edge faces both read this
+	TArray<bool> SolidCells;
+	SolidCells.SetNumZeroed(TotalGridCells);
+	for (int32 GridZ = 0; GridZ < GridZSize; GridZ++)
 	{
-		for (int32 GridZ = 0; GridZ < GridZSize; GridZ++)
+		for (int32 GridX = 0; GridX < GridXSize; GridX++)
 		{
-			float SegStartX = GridStartX + (GridX * SegmentSize);
-			float SegEndX = SegStartX + SegmentSize;
-			float SegStartZ = GridStartZ + (GridZ * SegmentSize);
-			float SegEndZ = SegStartZ + SegmentSize;
-			
-			// Check if this segment overlaps with the irregular polygon
-			bool bSegmentOverlapsHole = false;
-			
-			TArray<FVector2D> TestPoints = {
-				FVector2D(SegStartX, SegStartZ),  // Bottom-left
-				FVector2D(SegEndX, SegStartZ),    // Bottom-right  
-				FVector2D(SegEndX, SegEndZ),      // Top-right
-				FVector2D(SegStartX, SegEndZ),    // Top-left
-				FVector2D((SegStartX + SegEndX) * 0.5f, (SegStartZ + SegEndZ) * 0.5f) // Center
-			};
-			
-			for (const FVector2D& TestPoint : TestPoints)
+			if (IsCellSolid(GridX, GridZ))
 			{
-				// Convert test point to local coordinates relative to hole center
-				FVector2D LocalPoint(
-					TestPoint.X - WallCenterOffsetCm,
-					TestPoint.Y - HoleHeightCm
-				);
-				
-				// Check if point is inside irregular polygon
-				if (IsPointInIrregularPolygon(LocalPoint, IrregularPoints))
-				{
-					bSegmentOverlapsHole = true;
-					break;
-				}
+				SolidCells[GridZ * GridXSize + GridX] = true;
+				GeneratedSegments++;
 			}
-			
-			if (bSegmentOverlapsHole)
+		}
+	}
+	
+	auto IsSolid = [&](int32 CellGridX, int32 CellGridZ) -> bool {
+		return CellGridX >= 0 && CellGridX < GridXSize && CellGridZ >= 0 && CellGridZ < GridZSize
+			&& SolidCells[CellGridZ * GridXSize + CellGridX];
+	};
+	
+	// Check if we generated enough segments
+	int32 TotalPossibleSegments = GridXSize * GridZSize;
+	float WallCoveragePercent = (float)GeneratedSegments / (float)TotalPossibleSegments * 100.0f;
+	
+	if (GeneratedSegments < 8) // Lower threshold for irregular holes
+	{
+		UE_LOG(LogBackRoomGenerator, Error, TEXT("Irregular hole too large! Only %d segments generated (%.1f%% coverage). Falling back to solid wall."), 
+			GeneratedSegments, WallCoveragePercent);
+		
+		// Generate closed solid wall as fallback
+		UWallCommon::GenerateThickWallSegment(Vertices, Triangles, Normals, UVs,
+			InnerBL, InnerBR, InnerTR, InnerTL,
+			OuterBL, OuterBR, OuterTR, OuterTL,
+			WallWidth, WallHeight, WallThickness);
+		
+		return;
+	}
+	
+	// Triangles one box face pair per cell plus one frame quad per exposed cell edge would take
+	int32 UnmergedTriangles = 0;
+	for (int32 GridZ = 0; GridZ < GridZSize; GridZ++)
+	{
+		for (int32 GridX = 0; GridX < GridXSize; GridX++)
+		{
+			if (IsSolid(GridX, GridZ))
 			{
-				continue; // Skip this segment - it overlaps the hole
+				const int32 ExposedEdges = !IsSolid(GridX - 1, GridZ) + !IsSolid(GridX + 1, GridZ) + !IsSolid(GridX, GridZ - 1) + !IsSolid(GridX, GridZ + 1);
+				UnmergedTriangles += 4 + (ExposedEdges * 2);
 			}
-			
-			// Clamp segment to wall bounds
-			SegStartX = FMath::Max(0.0f, SegStartX);
-			SegEndX = FMath::Min(WallWidthCm, SegEndX);
-			SegStartZ = FMath::Max(0.0f, SegStartZ);
-			SegEndZ = FMath::Min(WallHeightCm, SegEndZ);
-			
-			// Skip if segment becomes too small
-			if ((SegEndX - SegStartX) < 1.0f || (SegEndZ - SegStartZ) < 1.0f)
+		}
+	}
+	
+	// Greedy meshing: grow each unclaimed solid cell into the widest run along X, then as many full rows along Z as fit
+	struct FCellRect
+	{
+		int32 MinX, MinZ, MaxX, MaxZ; // Inclusive cell ranges
+	};
+	TArray<FCellRect> CellRects;
+	TArray<bool> ClaimedCells;
+	ClaimedCells.SetNumZeroed(TotalGridCells);
+	
+	for (int32 GridZ = 0; GridZ < GridZSize; GridZ++)
+	{
+		for (int32 GridX = 0; GridX < GridXSize; GridX++)
+		{
+			if (!IsSolid(GridX, GridZ) || ClaimedCells[GridZ * GridXSize + GridX])
 			{
 				continue;
 			}
 			
-			// Generate this wall segment
-			FVector WallWidthDirection = (InnerBR - InnerBL).GetSafeNormal();
-			FVector WallHeightDirection = (InnerTL - InnerBL).GetSafeNormal();
-			
-			FVector SegInnerBL = InnerBL + (WallWidthDirection * SegStartX) + (WallHeightDirection * SegStartZ);
-			FVector SegInnerBR = InnerBL + (WallWidthDirection * SegEndX) + (WallHeightDirection * SegStartZ);
-			FVector SegInnerTR = InnerBL + (WallWidthDirection * SegEndX) + (WallHeightDirection * SegEndZ);
-			FVector SegInnerTL = InnerBL + (WallWidthDirection * SegStartX) + (WallHeightDirection * SegEndZ);
-			
-			FVector OuterWidthDirection = (OuterBR - OuterBL).GetSafeNormal();
-			FVector OuterHeightDirection = (OuterTL - OuterBL).GetSafeNormal();
-			
-			FVector SegOuterBL = OuterBL + (OuterWidthDirection * SegStartX) + (OuterHeightDirection * SegStartZ);
-			FVector SegOuterBR = OuterBL + (OuterWidthDirection * SegEndX) + (OuterHeightDirection * SegStartZ);
-			FVector SegOuterTR = OuterBL + (OuterWidthDirection * SegEndX) + (OuterHeightDirection * SegEndZ);
-			FVector SegOuterTL = OuterBL + (OuterWidthDirection * SegStartX) + (OuterHeightDirection * SegEndZ);
-			
-			// Generate wall segment using shared utilities
-			UWallCommon::FFaceData InnerFace, OuterFace, BottomFace, TopFace, LeftFace, RightFace;
-			
-			// Inner face
-			InnerFace.Vertices = {SegInnerBL, SegInnerBR, SegInnerTR, SegInnerTL};
-			InnerFace.Normal = FVector::CrossProduct((SegInnerBR - SegInnerBL).GetSafeNormal(), (SegInnerTL - SegInnerBL).GetSafeNormal());
-			InnerFace.UVs = {FVector2D(0, 0), FVector2D(SegmentSize/100.0f, 0), FVector2D(SegmentSize/100.0f, SegmentSize/100.0f), FVector2D(0, SegmentSize/100.0f)};
-			InnerFace.bReverseWinding = false;
-			UWallCommon::AddQuadFace(Vertices, Triangles, Normals, UVs, InnerFace);
-			
-			// Outer face
-			OuterFace.Vertices = {SegOuterBL, SegOuterBR, SegOuterTR, SegOuterTL};
-			OuterFace.Normal = -InnerFace.Normal;
-			OuterFace.UVs = {FVector2D(0, 0), FVector2D(SegmentSize/100.0f, 0), FVector2D(SegmentSize/100.0f, SegmentSize/100.0f), FVector2D(0, SegmentSize/100.0f)};
-			OuterFace.bReverseWinding = true;
-			UWallCommon::AddQuadFace(Vertices, Triangles, Normals, UVs, OuterFace);
-			
-			// Add side faces
-			float ThicknessUV = WallThickness;
-			
-			// Bottom face
-			BottomFace.Vertices = {SegInnerBL, SegOuterBL, SegOuterBR, SegInnerBR};
-			BottomFace.Normal = FVector(0, 0, -1);
-			BottomFace.UVs = {FVector2D(0, 0), FVector2D(ThicknessUV, 0), FVector2D(ThicknessUV, SegmentSize/100.0f), FVector2D(0, SegmentSize/100.0f)};
-			BottomFace.bReverseWinding = false;
-			UWallCommon::AddQuadFace(Vertices, Triangles, Normals, UVs, BottomFace);
-			
-			// Top face
-			TopFace.Vertices = {SegInnerTL, SegInnerTR, SegOuterTR, SegOuterTL};
-			TopFace.Normal = FVector(0, 0, 1);
-			TopFace.UVs = {FVector2D(0, 0), FVector2D(SegmentSize/100.0f, 0), FVector2D(SegmentSize/100.0f, ThicknessUV), FVector2D(0, ThicknessUV)};
-			TopFace.bReverseWinding = false;
-			UWallCommon::AddQuadFace(Vertices, Triangles, Normals, UVs, TopFace);
-			
-			// Left face
-			LeftFace.Vertices = {SegInnerTL, SegOuterTL, SegOuterBL, SegInnerBL};
-			LeftFace.Normal = (SegOuterBL - SegInnerBL).GetSafeNormal();
-			LeftFace.UVs = {FVector2D(0, SegmentSize/100.0f), FVector2D(ThicknessUV, SegmentSize/100.0f), FVector2D(ThicknessUV, 0), FVector2D(0, 0)};
-			LeftFace.bReverseWinding = false;
-			UWallCommon::AddQuadFace(Vertices, Triangles, Normals, UVs, LeftFace);
+			int32 MaxX = GridX;
+			while (IsSolid(MaxX + 1, GridZ) && !ClaimedCells[GridZ * GridXSize + MaxX + 1])
+			{
+				MaxX++;
+			}
 			
-			// Right face
-			RightFace.Vertices = {SegInnerBR, SegOuterBR, SegOuterTR, SegInnerTR};
-			RightFace.Normal = (SegOuterBR - SegInnerBR).GetSafeNormal();
-			RightFace.UVs = {FVector2D(0, 0), FVector2D(ThicknessUV, 0), FVector2D(ThicknessUV, SegmentSize/100.0f), FVector2D(0, SegmentSize/100.0f)};
-			RightFace.bReverseWinding = true;
-			UWallCommon::AddQuadFace(Vertices, Triangles, Normals, UVs, RightFace);
+			int32 MaxZ = GridZ;
+			for (bool bRowFits = true; bRowFits && MaxZ + 1 < GridZSize; )
+			{
+				for (int32 RowX = GridX; RowX <= MaxX && bRowFits; RowX++)
+				{
+					bRowFits = IsSolid(RowX, MaxZ + 1) && !ClaimedCells[(MaxZ + 1) * GridXSize + RowX];
+				}
+				if (bRowFits)
+				{
+					MaxZ++;
+				}
+			}
 			
-			GeneratedSegments++;
+			for (int32 RectZ = GridZ; RectZ <= MaxZ; RectZ++)
+			{
+				for (int32 RectX = GridX; RectX <= MaxX; RectX++)
+				{
+					ClaimedCells[RectZ * GridXSize + RectX] = true;
+				}
+			}
+			CellRects.Add({GridX, GridZ, MaxX, MaxZ});
 		}
 	}
 	
-	// Check if we generated enough segments
-	int32 TotalPossibleSegments = GridXSize * GridZSize;
-	float WallCoveragePercent = (float)GeneratedSegments / (float)TotalPossibleSegments * 100.0f;
+	FVector WallWidthDirection = (InnerBR - InnerBL).GetSafeNormal();
+	FVector WallHeightDirection = (InnerTL - InnerBL).GetSafeNormal();
+	FVector OuterWidthDirection = (OuterBR - OuterBL).GetSafeNormal();
+	FVector OuterHeightDirection = (OuterTL - OuterBL).GetSafeNormal();
 	
-	if (GeneratedSegments < 8) // Lower threshold for irregular holes
+	// Cell boundary positions, clamped to the wall bounds
+	auto CellEdgeX = [&](int32 EdgeGridX) { return FMath::Clamp(GridStartX + (EdgeGridX * SegmentSize), 0.0f, WallWidthCm); };
+	auto CellEdgeZ = [&](int32 EdgeGridZ) { return FMath::Clamp(GridStartZ + (EdgeGridZ * SegmentSize), 0.0f, WallHeightCm); };
+	auto InnerPoint = [&](float X, float Z) { return InnerBL + (WallWidthDirection * X) + (WallHeightDirection * Z); };
+	auto OuterPoint = [&](float X, float Z) { return OuterBL + (OuterWidthDirection * X) + (OuterHeightDirection * Z); };
+	
+	// Size pass: inner + outer quad per rectangle, plus one frame quad per run of open neighbours along each side
+	auto CountOpenRuns = [](int32 From, int32 To, auto&& IsNeighbourSolid)
 	{
-		UE_LOG(LogBackRoomGenerator, Error, TEXT("Irregular hole too large! Only %d segments generated (%.1f%% coverage). Falling back to solid wall."), 
-			GeneratedSegments, WallCoveragePercent);
+		int32 Runs = 0;
+		for (int32 i = From; i <= To; i++)
+		{
+			Runs += !IsNeighbourSolid(i) && (i == From || IsNeighbourSolid(i - 1));
+		}
+		return Runs;
+	};
+	int32 NumQuads = 0;
+	for (const FCellRect& Rect : CellRects)
+	{
+		NumQuads += 2;
+		NumQuads += CountOpenRuns(Rect.MinZ, Rect.MaxZ, [&](int32 Z) { return IsSolid(Rect.MinX - 1, Z); });
+		NumQuads += CountOpenRuns(Rect.MinZ, Rect.MaxZ, [&](int32 Z) { return IsSolid(Rect.MaxX + 1, Z); });
+		NumQuads += CountOpenRuns(Rect.MinX, Rect.MaxX, [&](int32 X) { return IsSolid(X, Rect.MinZ - 1); });
+		NumQuads += CountOpenRuns(Rect.MinX, Rect.MaxX, [&](int32 X) { return IsSolid(X, Rect.MaxZ + 1); });
+	}
+	
+	const int32 TrianglesBefore = Triangles.Num();
+	UWallCommon::FReservedEmit Emit(Vertices, Triangles, Normals, UVs,
+		NumQuads * UWallCommon::VerticesPerQuad, NumQuads * UWallCommon::IndicesPerQuad, TEXT("GenerateWallWithHole (cell grid)"));
+	
+	for (const FCellRect& Rect : CellRects)
+	{
+		float SegStartX = CellEdgeX(Rect.MinX);
+		float SegEndX = CellEdgeX(Rect.MaxX + 1);
+		float SegStartZ = CellEdgeZ(Rect.MinZ);
+		float SegEndZ = CellEdgeZ(Rect.MaxZ + 1);
 		
-		// Generate fallback solid wall
+		FVector SegInnerBL = InnerPoint(SegStartX, SegStartZ);
+		FVector SegInnerBR = InnerPoint(SegEndX, SegStartZ);
+		FVector SegInnerTR = InnerPoint(SegEndX, SegEndZ);
+		FVector SegInnerTL = InnerPoint(SegStartX, SegEndZ);
+		
+		FVector SegOuterBL = OuterPoint(SegStartX, SegStartZ);
+		FVector SegOuterBR = OuterPoint(SegEndX, SegStartZ);
+		FVector SegOuterTR = OuterPoint(SegEndX, SegEndZ);
+		FVector SegOuterTL = OuterPoint(SegStartX, SegEndZ);
+		
+		const float RectWidthUV = (SegEndX - SegStartX) / 100.0f;
+		const float RectHeightUV = (SegEndZ - SegStartZ) / 100.0f;
+		
+		// Generate wall segment using shared utilities
 		UWallCommon::FFaceData InnerFace, OuterFace;
 		
-		InnerFace.Vertices = {InnerBL, InnerBR, InnerTR, InnerTL};
-		InnerFace.Normal = FVector::CrossProduct((InnerBR - InnerBL).GetSafeNormal(), (InnerTL - InnerBL).GetSafeNormal());
-		InnerFace.UVs = {FVector2D(0, 0), FVector2D(WallWidth, 0), FVector2D(WallWidth, WallHeight), FVector2D(0, WallHeight)};
+		// Inner face
+		InnerFace.Vertices = {SegInnerBL, SegInnerBR, SegInnerTR, SegInnerTL};
+		InnerFace.Normal = FVector::CrossProduct((SegInnerBR - SegInnerBL).GetSafeNormal(), (SegInnerTL - SegInnerBL).GetSafeNormal());
+		InnerFace.UVs = {FVector2D(0, 0), FVector2D(RectWidthUV, 0), FVector2D(RectWidthUV, RectHeightUV), FVector2D(0, RectHeightUV)};
 		InnerFace.bReverseWinding = false;
 		UWallCommon::AddQuadFace(Vertices, Triangles, Normals, UVs, InnerFace);
 		
-		OuterFace.Vertices = {OuterBL, OuterBR, OuterTR, OuterTL};
+		// Outer face
+		OuterFace.Vertices = {SegOuterBL, SegOuterBR, SegOuterTR, SegOuterTL};
 		OuterFace.Normal = -InnerFace.Normal;
-		OuterFace.UVs = {FVector2D(0, 0), FVector2D(WallWidth, 0), FVector2D(WallWidth, WallHeight), FVector2D(0, WallHeight)};
+		OuterFace.UVs = {FVector2D(0, 0), FVector2D(RectWidthUV, 0), FVector2D(RectWidthUV, RectHeightUV), FVector2D(0, RectHeightUV)};
 		OuterFace.bReverseWinding = true;
 		UWallCommon::AddQuadFace(Vertices, Triangles, Normals, UVs, OuterFace);
 		
+		// Edge faces only where the rectangle borders hole cells or the wall edge, one quad per contiguous run
+		// AddDoorFrame faces along (OuterV1 - InnerV1) x (InnerV2 - InnerV1), so corners are ordered to face away from the rectangle
+		for (int32 RunStart = Rect.MinZ; RunStart <= Rect.MaxZ; RunStart++) // Left edge
+		{
+			if (IsSolid(Rect.MinX - 1, RunStart)) continue;
+			int32 RunEnd = RunStart;
+			while (RunEnd + 1 <= Rect.MaxZ && !IsSolid(Rect.MinX - 1, RunEnd + 1)) RunEnd++;
+			const float Z0 = CellEdgeZ(RunStart), Z1 = CellEdgeZ(RunEnd + 1);
+			UWallCommon::AddDoorFrame(Vertices, Triangles, Normals, UVs, 
+				InnerPoint(SegStartX, Z1), OuterPoint(SegStartX, Z1), OuterPoint(SegStartX, Z0), InnerPoint(SegStartX, Z0), WallThickness, (Z1 - Z0) / 100.0f);
+			RunStart = RunEnd;
+		}
+		
+		for (int32 RunStart = Rect.MinZ; RunStart <= Rect.MaxZ; RunStart++) // Right edge
+		{
+			if (IsSolid(Rect.MaxX + 1, RunStart)) continue;
+			int32 RunEnd = RunStart;
+			while (RunEnd + 1 <= Rect.MaxZ && !IsSolid(Rect.MaxX + 1, RunEnd + 1)) RunEnd++;
+			const float Z0 = CellEdgeZ(RunStart), Z1 = CellEdgeZ(RunEnd + 1);
+			UWallCommon::AddDoorFrame(Vertices, Triangles, Normals, UVs, 
+				InnerPoint(SegEndX, Z0), OuterPoint(SegEndX, Z0), OuterPoint(SegEndX, Z1), InnerPoint(SegEndX, Z1), WallThickness, (Z1 - Z0) / 100.0f);
+			RunStart = RunEnd;
+		}
+		
+		for (int32 RunStart = Rect.MinX; RunStart <= Rect.MaxX; RunStart++) // Bottom edge
+		{
+			if (IsSolid(RunStart, Rect.MinZ - 1)) continue;
+			int32 RunEnd = RunStart;
+			while (RunEnd + 1 <= Rect.MaxX && !IsSolid(RunEnd + 1, Rect.MinZ - 1)) RunEnd++;
+			const float X0 = CellEdgeX(RunStart), X1 = CellEdgeX(RunEnd + 1);
+			UWallCommon::AddDoorFrame(Vertices, Triangles, Normals, UVs, 
+				InnerPoint(X0, SegStartZ), OuterPoint(X0, SegStartZ), OuterPoint(X1, SegStartZ), InnerPoint(X1, SegStartZ), WallThickness, (X1 - X0) / 100.0f);
+			RunStart = RunEnd;
+		}
+		
+		for (int32 RunStart = Rect.MinX; RunStart <= Rect.MaxX; RunStart++) // Top edge
+		{
+			if (IsSolid(RunStart, Rect.MaxZ + 1)) continue;
+			int32 RunEnd = RunStart;
+			while (RunEnd + 1 <= Rect.MaxX && !IsSolid(RunEnd + 1, Rect.MaxZ + 1)) RunEnd++;
+			const float X0 = CellEdgeX(RunStart), X1 = CellEdgeX(RunEnd + 1);
+			UWallCommon::AddDoorFrame(Vertices, Triangles, Normals, UVs, 
+				InnerPoint(X1, SegEndZ), OuterPoint(X1, SegEndZ), OuterPoint(X0, SegEndZ), InnerPoint(X0, SegEndZ), WallThickness, (X1 - X0) / 100.0f);
+			RunStart = RunEnd;
+		}
+	}
+	
+	const int32 MergedTriangles = (Triangles.Num() - TrianglesBefore) / 3;
+	UE_LOG(LogBackRoomGenerator, Log, TEXT("OPTIMIZED irregular hole complete: %d segments (%.1f%% coverage) from %d grid cells merged into %d rectangles, %d -> %d triangles, %d polygon points, seed %d"), 
+		GeneratedSegments, WallCoveragePercent, TotalGridCells, CellRects.Num(), UnmergedTriangles, MergedTriangles, Hole.PolygonPoints, Hole.Seed);
+}
+
+void UHoleGenerator::GenerateCollisionRects(float WallWidth, float WallHeight, const FResolvedHole& Hole, TArray<FBox2D>& OutSolidRects)
+{
+	const float WallWidthCm = MetersToUnrealUnits(WallWidth);
+	const float WallHeightCm = MetersToUnrealUnits(WallHeight);
+	
+	// Same polygon the mesh is cut around, moved into wall space
+	TArray<FVector2D> HolePoints = GenerateIrregularPolygon(Hole);
+	FBox2D HoleBounds(ForceInit);
+	for (FVector2D& Point : HolePoints)
+	{
+		Point += FVector2D(Hole.CenterXCm, Hole.CenterZCm);
+		HoleBounds += Point;
+	}
+	
+	const float HoleLeft = FMath::Clamp(HoleBounds.Min.X, 0.0f, WallWidthCm);
+	const float HoleRight = FMath::Clamp(HoleBounds.Max.X, 0.0f, WallWidthCm);
+	const float HoleBottom = FMath::Clamp(HoleBounds.Min.Y, 0.0f, WallHeightCm);
+	const float HoleTop = FMath::Clamp(HoleBounds.Max.Y, 0.0f, WallHeightCm);
+	
+	auto AddRect = [&OutSolidRects](float MinX, float MinZ, float MaxX, float MaxZ)
+	{
+		if ((MaxX - MinX) >= 1.0f && (MaxZ - MinZ) >= 1.0f)
+		{
+			OutSolidRects.Add(FBox2D(FVector2D(MinX, MinZ), FVector2D(MaxX, MaxZ)));
+		}
+	};
+	
+	if (!HoleBounds.bIsValid || (HoleRight - HoleLeft) < 1.0f || (HoleTop - HoleBottom) < 1.0f)
+	{
+		AddRect(0.0f, 0.0f, WallWidthCm, WallHeightCm);
 		return;
 	}
 	
-	// Add edge faces for hole borders - only for segments that have exposed edges
-	FVector WallWidthDirection = (InnerBR - InnerBL).GetSafeNormal();
-	FVector WallHeightDirection = (InnerTL - InnerBL).GetSafeNormal();
+	// Full-height strips beside the hole bounds, then the parts above and below it
+	AddRect(0.0f, 0.0f, HoleLeft, WallHeightCm);
+	AddRect(HoleRight, 0.0f, WallWidthCm, WallHeightCm);
+	AddRect(HoleLeft, 0.0f, HoleRight, HoleBottom);
+	AddRect(HoleLeft, HoleTop, HoleRight, WallHeightCm);
+	
+	// Inside the bounds: coarse cells, solid only if the hole neither covers the cell center nor crosses the cell
+	const float CellSize = FMath::Clamp(FMath::Max(HoleRight - HoleLeft, HoleTop - HoleBottom) / 8.0f, 10.0f, 50.0f);
+	const int32 Columns = FMath::Max(1, FMath::FloorToInt((HoleRight - HoleLeft) / CellSize));
+	const int32 Rows = FMath::Max(1, FMath::FloorToInt((HoleTop - HoleBottom) / CellSize));
+	const float StepX = (HoleRight - HoleLeft) / Columns;
+	const float StepZ = (HoleTop - HoleBottom) / Rows;
+	
+	// Scale the polygon so cells are unit squares, then classify cell centers with one scanline pass
+	TArray<bool> CenterInHole;
+	TArray<FVector2D> ScaledPoints;
+	ScaledPoints.Reserve(HolePoints.Num());
+	for (const FVector2D& Point : HolePoints)
+	{
+		ScaledPoints.Add(FVector2D((Point.X - HoleLeft) / StepX, (Point.Y - HoleBottom) / StepZ));
+	}
+	RasterizePolygonInside(ScaledPoints, 0.5f, 0.5f, 1.0f, Columns, Rows, CenterInHole);
 	
-	for (int32 GridX = 0; GridX < GridXSize; GridX++)
+	// A cell the hole only partly covers has the hole outline running through it - mark every cell an outline edge touches,
+	// so a narrow opening between sample points can never end up under a solid box
+	TArray<bool> OnOutline;
+	OnOutline.SetNumZeroed(Columns * Rows);
+	for (int32 PointIndex = 0; PointIndex < ScaledPoints.Num(); PointIndex++)
 	{
-		for (int32 GridZ = 0; GridZ < GridZSize; GridZ++)
+		const FVector2D& A = ScaledPoints[PointIndex];
+		const FVector2D& B = ScaledPoints[(PointIndex + 1) % ScaledPoints.Num()];
+		const int32 MinCellX = FMath::Clamp(FMath::FloorToInt(FMath::Min(A.X, B.X)), 0, Columns - 1);
+		const int32 MaxCellX = FMath::Clamp(FMath::FloorToInt(FMath::Max(A.X, B.X)), 0, Columns - 1);
+		const int32 MinCellZ = FMath::Clamp(FMath::FloorToInt(FMath::Min(A.Y, B.Y)), 0, Rows - 1);
+		const int32 MaxCellZ = FMath::Clamp(FMath::FloorToInt(FMath::Max(A.Y, B.Y)), 0, Rows - 1);
+		const FVector2D Delta = B - A;
+		for (int32 Z = MinCellZ; Z <= MaxCellZ; Z++)
 		{
-			float SegStartX = GridStartX + (GridX * SegmentSize);
-			float SegEndX = SegStartX + SegmentSize;
-			float SegStartZ = GridStartZ + (GridZ * SegmentSize);
-			float SegEndZ = SegStartZ + SegmentSize;
-			
-			// Check if this segment exists (not part of hole)
-			bool bSegmentExists = true;
-			TArray<FVector2D> TestPoints = {
-				FVector2D(SegStartX, SegStartZ),  
-				FVector2D(SegEndX, SegStartZ),    
-				FVector2D(SegEndX, SegEndZ),      
-				FVector2D(SegStartX, SegEndZ),    
-				FVector2D((SegStartX + SegEndX) * 0.5f, (SegStartZ + SegEndZ) * 0.5f)
-			};
-			
-			for (const FVector2D& TestPoint : TestPoints)
+			for (int32 X = MinCellX; X <= MaxCellX; X++)
 			{
-				FVector2D LocalPoint(TestPoint.X - WallCenterOffsetCm, TestPoint.Y - HoleHeightCm);
-				if (IsPointInIrregularPolygon(LocalPoint, IrregularPoints))
+				// Clip the edge against the closed cell square (Liang-Barsky); anything left means it touches the cell
+				float T0 = 0.0f, T1 = 1.0f;
+				const float P[4] = { -Delta.X, Delta.X, -Delta.Y, Delta.Y };
+				const float Q[4] = { A.X - X, (X + 1) - A.X, A.Y - Z, (Z + 1) - A.Y };
+				bool bTouches = true;
+				for (int32 Side = 0; Side < 4 && bTouches; Side++)
 				{
-					bSegmentExists = false;
-					break;
+					if (P[Side] == 0.0f)
+					{
+						bTouches = Q[Side] >= 0.0f;
+					}
+					else if (P[Side] < 0.0f)
+					{
+						T0 = FMath::Max(T0, Q[Side] / P[Side]);
+					}
+					else
+					{
+						T1 = FMath::Min(T1, Q[Side] / P[Side]);
+					}
+					bTouches = bTouches && T0 <= T1;
+				}
+				if (bTouches)
+				{
+					OnOutline[Z * Columns + X] = true;
 				}
 			}
-			
-			if (!bSegmentExists)
+		}
+	}
+	
+	auto IsSolid = [&](int32 X, int32 Z) -> bool
+	{
+		if (X < 0 || X >= Columns || Z < 0 || Z >= Rows)
+		{
+			return false;
+		}
+		return !CenterInHole[Z * Columns + X] && !OnOutline[Z * Columns + X];
+	};
+	
+	// Greedy merge: widest run in a row, grown upwards while the whole run stays solid
+	TArray<bool> ClaimedCells;
+	ClaimedCells.SetNumZeroed(Columns * Rows);
+	for (int32 Z = 0; Z < Rows; Z++)
+	{
+		for (int32 X = 0; X < Columns; X++)
+		{
+			if (!IsSolid(X, Z) || ClaimedCells[Z * Columns + X])
 			{
-				continue; // Skip hole segments
+				continue;
 			}
 			
-			// Check if segment is within wall bounds
-			if (SegStartX < 0 || SegEndX > WallWidthCm || SegStartZ < 0 || SegEndZ > WallHeightCm)
+			int32 MaxX = X;
+			while (IsSolid(MaxX + 1, Z) && !ClaimedCells[Z * Columns + MaxX + 1])
 			{
-				continue;
+				MaxX++;
 			}
 			
-			// Helper function to check if a neighboring segment is missing
-			auto IsNeighborMissing = [&](int32 NeighborGridX, int32 NeighborGridZ) -> bool {
-				// Outside grid bounds
-				if (NeighborGridX < 0 || NeighborGridX >= GridXSize || NeighborGridZ < 0 || NeighborGridZ >= GridZSize)
+			int32 MaxZ = Z;
+			for (bool bRowFits = true; bRowFits && MaxZ + 1 < Rows; )
+			{
+				for (int32 RowX = X; RowX <= MaxX && bRowFits; RowX++)
 				{
-					return true;
+					bRowFits = IsSolid(RowX, MaxZ + 1) && !ClaimedCells[(MaxZ + 1) * Columns + RowX];
 				}
-				
-				// Calculate neighbor segment
-				float NeighborStartX = GridStartX + (NeighborGridX * SegmentSize);
-				float NeighborEndX = NeighborStartX + SegmentSize;
-				float NeighborStartZ = GridStartZ + (NeighborGridZ * SegmentSize);
-				float NeighborEndZ = NeighborStartZ + SegmentSize;
-				
-				// Outside wall bounds
-				if (NeighborStartX < 0 || NeighborEndX > WallWidthCm || NeighborStartZ < 0 || NeighborEndZ > WallHeightCm)
+				if (bRowFits)
 				{
-					return true;
+					MaxZ++;
 				}
-				
-				// Check if neighbor overlaps with polygon
-				TArray<FVector2D> NeighborTestPoints = {
-					FVector2D(NeighborStartX, NeighborStartZ),  
-					FVector2D(NeighborEndX, NeighborStartZ),    
-					FVector2D(NeighborEndX, NeighborEndZ),      
-					FVector2D(NeighborStartX, NeighborEndZ),    
-					FVector2D((NeighborStartX + NeighborEndX) * 0.5f, (NeighborStartZ + NeighborEndZ) * 0.5f)
-				};
-				
-				for (const FVector2D& TestPoint : NeighborTestPoints)
+			}
+			
+			for (int32 ClaimZ = Z; ClaimZ <= MaxZ; ClaimZ++)
+			{
+				for (int32 ClaimX = X; ClaimX <= MaxX; ClaimX++)
 				{
-					FVector2D LocalPoint(TestPoint.X - WallCenterOffsetCm, TestPoint.Y - HoleHeightCm);
-					if (IsPointInIrregularPolygon(LocalPoint, IrregularPoints))
-					{
-						return true; // Neighbor is part of hole
-					}
+					ClaimedCells[ClaimZ * Columns + ClaimX] = true;
 				}
-				
-				return false; // Neighbor exists
-			};
-			
-			// Clamp segment to wall bounds
-			SegStartX = FMath::Max(0.0f, SegStartX);
-			SegEndX = FMath::Min(WallWidthCm, SegEndX);
-			SegStartZ = FMath::Max(0.0f, SegStartZ);
-			SegEndZ = FMath::Min(WallHeightCm, SegEndZ);
+			}
 			
-			if ((SegEndX - SegStartX) < 1.0f || (SegEndZ - SegStartZ) < 1.0f)
+			AddRect(HoleLeft + (X * StepX), HoleBottom + (Z * StepZ), HoleLeft + ((MaxX + 1) * StepX), HoleBottom + ((MaxZ + 1) * StepZ));
+		}
+	}
+}
+
+bool UHoleGenerator::GenerateTriangulatedWallWithHole(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
+	FVector InnerBL, FVector InnerBR, FVector InnerTL, FVector OuterBL, FVector OuterBR, FVector OuterTL,
+	float WallWidthCm, float WallHeightCm, const TArray<FVector2D>& HolePoints, float WallThickness)
+{
+	const int32 NumHolePoints = HolePoints.Num();
+	if (NumHolePoints < 3)
+	{
+		return false;
+	}
+	
+	// The hole must be a closed ring strictly inside the wall (1cm margin, same as the rectangle path)
+	for (const FVector2D& Point : HolePoints)
+	{
+		if (Point.X < 1.0f || Point.X > WallWidthCm - 1.0f || Point.Y < 1.0f || Point.Y > WallHeightCm - 1.0f)
+		{
+			return false;
+		}
+	}
+	
+	double SignedArea = 0.0;
+	for (int32 i = 0, j = NumHolePoints - 1; i < NumHolePoints; j = i++)
+	{
+		SignedArea += (HolePoints[j].X * HolePoints[i].Y) - (HolePoints[i].X * HolePoints[j].Y);
+	}
+	if (FMath::Abs(SignedArea) < 2.0 || !IsSimplePolygon(HolePoints))
+	{
+		return false;
+	}
+	
+	// Hole ring counter-clockwise for the rim, clockwise when bridged into the counter-clockwise wall outline
+	TArray<FVector2D> HoleCCW = HolePoints;
+	if (SignedArea < 0.0)
+	{
+		Algo::Reverse(HoleCCW);
+	}
+	
+	// Bridge from the rightmost hole point straight across to the right wall edge - nothing of the hole lies beyond it
+	int32 BridgeIndex = 0;
+	for (int32 i = 1; i < NumHolePoints; i++)
+	{
+		if (HoleCCW[i].X > HoleCCW[BridgeIndex].X)
+		{
+			BridgeIndex = i;
+		}
+	}
+	const FVector2D BridgeHole = HoleCCW[BridgeIndex];
+	const FVector2D BridgeEdge(WallWidthCm, BridgeHole.Y);
+	
+	TArray<FVector2D> Polygon;
+	Polygon.Reserve(NumHolePoints + 7);
+	Polygon.Add(FVector2D(0.0f, 0.0f));
+	Polygon.Add(FVector2D(WallWidthCm, 0.0f));
+	Polygon.Add(BridgeEdge);
+	for (int32 Step = 0; Step <= NumHolePoints; Step++)
+	{
+		// Walk the hole clockwise, ending back on the bridge point
+		Polygon.Add(HoleCCW[(BridgeIndex - Step + NumHolePoints) % NumHolePoints]);
+	}
+	Polygon.Add(BridgeEdge);
+	Polygon.Add(FVector2D(WallWidthCm, WallHeightCm));
+	Polygon.Add(FVector2D(0.0f, WallHeightCm));
+	
+	TArray<int32> FaceTriangles;
+	if (!TriangulatePolygon(Polygon, FaceTriangles))
+	{
+		return false;
+	}
+	
+	const FVector WidthDir = (InnerBR - InnerBL).GetSafeNormal();
+	const FVector HeightDir = (InnerTL - InnerBL).GetSafeNormal();
+	const FVector OuterWidthDir = (OuterBR - OuterBL).GetSafeNormal();
+	const FVector OuterHeightDir = (OuterTL - OuterBL).GetSafeNormal();
+	const FVector InnerNormal = (InnerBL - OuterBL).GetSafeNormal();
+	
+	auto InnerPoint = [&](const FVector2D& P) { return InnerBL + (WidthDir * P.X) + (HeightDir * P.Y); };
+	auto OuterPoint = [&](const FVector2D& P) { return OuterBL + (OuterWidthDir * P.X) + (OuterHeightDir * P.Y); };
+	
+	// Counter-clockwise in wall space faces along Width x Height - flip for whichever face points the other way
+	const bool bCCWFacesInner = FVector::DotProduct(FVector::CrossProduct(WidthDir, HeightDir), InnerNormal) > 0.0f;
+	
+	// Two face rings over the bridged polygon, then the four outer edges and one rim quad per hole edge
+	const int32 NumEdgeQuads = 4 + NumHolePoints;
+	UWallCommon::FReservedEmit Emit(Vertices, Triangles, Normals, UVs,
+		(2 * Polygon.Num()) + (NumEdgeQuads * UWallCommon::VerticesPerQuad),
+		(2 * FaceTriangles.Num()) + (NumEdgeQuads * UWallCommon::IndicesPerQuad),
+		TEXT("GenerateTriangulatedWallWithHole"));
+	
+	// === WALL FACES: one shared ring of vertices per side ===
+	for (int32 Side = 0; Side < 2; Side++)
+	{
+		const bool bInner = (Side == 0);
+		const int32 BaseIndex = Vertices.Num();
+		for (const FVector2D& Point : Polygon)
+		{
+			Vertices.Add(bInner ? InnerPoint(Point) : OuterPoint(Point));
+			Normals.Add(bInner ? InnerNormal : -InnerNormal);
+			UVs.Add(Point / 100.0f);
+		}
+		
+		const bool bKeepWinding = (bInner == bCCWFacesInner);
+		for (int32 i = 0; i < FaceTriangles.Num(); i += 3)
+		{
+			Triangles.Add(BaseIndex + FaceTriangles[i]);
+			Triangles.Add(BaseIndex + FaceTriangles[bKeepWinding ? i + 1 : i + 2]);
+			Triangles.Add(BaseIndex + FaceTriangles[bKeepWinding ? i + 2 : i + 1]);
+		}
+	}
+	
+	// Thickness face along wall-space segment A-B
+	const float ThicknessUV = WallThickness;
+	auto AddEdge = [&](const FVector2D& A, const FVector2D& B, const FVector& Normal)
+	{
+		const float Length = FVector2D::Distance(A, B) / 100.0f;
+		UWallCommon::FFaceData Face;
+		Face.Vertices = {InnerPoint(A), InnerPoint(B), OuterPoint(B), OuterPoint(A)};
+		Face.Normal = Normal;
+		Face.UVs = {FVector2D(0, 0), FVector2D(Length, 0), FVector2D(Length, ThicknessUV), FVector2D(0, ThicknessUV)};
+		UWallCommon::AddOutwardQuadFace(Vertices, Triangles, Normals, UVs, Face);
+	};
+	
+	// === OUTER EDGES ===
+	AddEdge(FVector2D(0.0f, 0.0f), FVector2D(WallWidthCm, 0.0f), -HeightDir);
+	AddEdge(FVector2D(0.0f, WallHeightCm), FVector2D(WallWidthCm, WallHeightCm), HeightDir);
+	AddEdge(FVector2D(0.0f, 0.0f), FVector2D(0.0f, WallHeightCm), -WidthDir);
+	AddEdge(FVector2D(WallWidthCm, 0.0f), FVector2D(WallWidthCm, WallHeightCm), WidthDir);
+	
+	// === HOLE RIM: the hole is left of each counter-clockwise edge, so the rim faces that way ===
+	for (int32 i = 0; i < NumHolePoints; i++)
+	{
+		const FVector2D& A = HoleCCW[i];
+		const FVector2D& B = HoleCCW[(i + 1) % NumHolePoints];
+		const FVector2D EdgeDir = B - A;
+		AddEdge(A, B, ((WidthDir * -EdgeDir.Y) + (HeightDir * EdgeDir.X)).GetSafeNormal());
+	}
+	
+	return true;
+}
+
+bool UHoleGenerator::TriangulatePolygon(const TArray<FVector2D>& Polygon, TArray<int32>& OutTriangles)
+{
+	auto Cross = [](const FVector2D& O, const FVector2D& A, const FVector2D& B)
+	{
+		return ((A.X - O.X) * (B.Y - O.Y)) - ((A.Y - O.Y) * (B.X - O.X));
+	};
+	const double Epsilon = 1e-4; // cm^2
+	
+	TArray<int32> Remaining;
+	Remaining.Reserve(Polygon.Num());
+	for (int32 i = 0; i < Polygon.Num(); i++)
+	{
+		Remaining.Add(i);
+	}
+	OutTriangles.Reserve(OutTriangles.Num() + (Polygon.Num() - 2) * 3);
+	
+	while (Remaining.Num() > 3)
+	{
+		const int32 Count = Remaining.Num();
+		bool bClipped = false;
+		
+		for (int32 k = 0; k < Count && !bClipped; k++)
+		{
+			const int32 IA = Remaining[(k + Count - 1) % Count];
+			const int32 IB = Remaining[k];
+			const int32 IC = Remaining[(k + 1) % Count];
+			const FVector2D& A = Polygon[IA];
+			const FVector2D& B = Polygon[IB];
+			const FVector2D& C = Polygon[IC];
+			
+			// Ear tip must be convex
+			if (Cross(A, B, C) <= Epsilon)
 			{
 				continue;
 			}
 			
-			// Calculate segment corners
-			FVector SegInnerBL = InnerBL + (WallWidthDirection * SegStartX) + (WallHeightDirection * SegStartZ);
-			FVector SegInnerBR = InnerBL + (WallWidthDirection * SegEndX) + (WallHeightDirection * SegStartZ);
-			FVector SegInnerTR = InnerBL + (WallWidthDirection * SegEndX) + (WallHeightDirection * SegEndZ);
-			FVector SegInnerTL = InnerBL + (WallWidthDirection * SegStartX) + (WallHeightDirection * SegEndZ);
-			
-			FVector OuterWidthDirection = (OuterBR - OuterBL).GetSafeNormal();
-			FVector OuterHeightDirection = (OuterTL - OuterBL).GetSafeNormal();
-			
-			FVector SegOuterBL = OuterBL + (OuterWidthDirection * SegStartX) + (OuterHeightDirection * SegStartZ);
-			FVector SegOuterBR = OuterBL + (OuterWidthDirection * SegEndX) + (OuterHeightDirection * SegStartZ);
-			FVector SegOuterTR = OuterBL + (OuterWidthDirection * SegEndX) + (OuterHeightDirection * SegEndZ);
-			FVector SegOuterTL = OuterBL + (OuterWidthDirection * SegStartX) + (OuterHeightDirection * SegEndZ);
-			
-			// Add edge faces only for edges that border missing segments
-			if (IsNeighborMissing(GridX - 1, GridZ)) // Left edge
+			// No other vertex inside or on the ear (bridge duplicates share positions with a corner - skip those)
+			bool bIsEar = true;
+			for (int32 Index : Remaining)
 			{
-				UWallCommon::AddDoorFrame(Vertices, Triangles, Normals, UVs, 
-					SegInnerBL, SegOuterBL, SegOuterTL, SegInnerTL, WallThickness, (SegEndZ - SegStartZ) / 100.0f);
+				const FVector2D& P = Polygon[Index];
+				if (P.Equals(A, 0.0f) || P.Equals(B, 0.0f) || P.Equals(C, 0.0f))
+				{
+					continue;
+				}
+				if (Cross(A, B, P) >= 0.0 && Cross(B, C, P) >= 0.0 && Cross(C, A, P) >= 0.0)
+				{
+					bIsEar = false;
+					break;
+				}
 			}
 			
-			if (IsNeighborMissing(GridX + 1, GridZ)) // Right edge
+			if (bIsEar)
 			{
-				UWallCommon::AddDoorFrame(Vertices, Triangles, Normals, UVs, 
-					SegInnerBR, SegOuterBR, SegOuterTR, SegInnerTR, WallThickness, (SegEndZ - SegStartZ) / 100.0f);
+				OutTriangles.Add(IA);
+				OutTriangles.Add(IB);
+				OutTriangles.Add(IC);
+				Remaining.RemoveAt(k);
+				bClipped = true;
 			}
-			
-			if (IsNeighborMissing(GridX, GridZ - 1)) // Bottom edge
+		}
+		
+		if (!bClipped)
+		{
+			// Only collinear points left to clip - drop one without emitting a sliver
+			for (int32 k = 0; k < Count && !bClipped; k++)
+			{
+				const FVector2D& A = Polygon[Remaining[(k + Count - 1) % Count]];
+				const FVector2D& C = Polygon[Remaining[(k + 1) % Count]];
+				if (FMath::Abs(Cross(A, Polygon[Remaining[k]], C)) <= Epsilon)
+				{
+					Remaining.RemoveAt(k);
+					bClipped = true;
+				}
+			}
+		}
+		
+		if (!bClipped)
+		{
+			return false;
+		}
+	}
+	
+	if (Cross(Polygon[Remaining[0]], Polygon[Remaining[1]], Polygon[Remaining[2]]) > Epsilon)
+	{
+		OutTriangles.Append(Remaining);
+	}
+	return true;
+}
+
+bool UHoleGenerator::IsSimplePolygon(const TArray<FVector2D>& PolygonPoints)
+{
+	auto Cross = [](const FVector2D& O, const FVector2D& A, const FVector2D& B)
+	{
+		return ((A.X - O.X) * (B.Y - O.Y)) - ((A.Y - O.Y) * (B.X - O.X));
+	};
+	
+	const int32 Count = PolygonPoints.Num();
+	for (int32 i = 0; i < Count; i++)
+	{
+		const FVector2D& A1 = PolygonPoints[i];
+		const FVector2D& A2 = PolygonPoints[(i + 1) % Count];
+		
+		// Skip the edge itself and both neighbours (they share an endpoint)
+		for (int32 j = i + 2; j < Count; j++)
+		{
+			if (i == 0 && j == Count - 1)
 			{
-				UWallCommon::AddDoorFrame(Vertices, Triangles, Normals, UVs, 
-					SegInnerBL, SegOuterBL, SegOuterBR, SegInnerBR, WallThickness, (SegEndX - SegStartX) / 100.0f);
+				continue;
 			}
 			
-			if (IsNeighborMissing(GridX, GridZ + 1)) // Top edge
+			const FVector2D& B1 = PolygonPoints[j];
+			const FVector2D& B2 = PolygonPoints[(j + 1) % Count];
+			const double D1 = Cross(B1, B2, A1);
+			const double D2 = Cross(B1, B2, A2);
+			const double D3 = Cross(A1, A2, B1);
+			const double D4 = Cross(A1, A2, B2);
+			if (((D1 > 0.0) != (D2 > 0.0)) && ((D3 > 0.0) != (D4 > 0.0)))
 			{
-				UWallCommon::AddDoorFrame(Vertices, Triangles, Normals, UVs, 
-					SegInnerTL, SegOuterTL, SegOuterTR, SegInnerTR, WallThickness, (SegEndX - SegStartX) / 100.0f);
+				return false;
 			}
 		}
 	}
 	
-	UE_LOG(LogBackRoomGenerator, Log, TEXT("OPTIMIZED irregular hole complete: %d segments (%.1f%% coverage) from %d grid cells, %d polygon points, seed %d"), 
-		GeneratedSegments, WallCoveragePercent, TotalGridCells, Door.IrregularPoints, Door.RandomSeed);
+	return true;
 }
 
-bool UHoleGenerator::IsPointInIrregularPolygon(const FVector2D& Point, const TArray<FVector2D>& PolygonPoints)
+int32 UHoleGenerator::RasterizePolygonInside(const TArray<FVector2D>& PolygonPoints, float StartX, float StartZ, float Step,
+	int32 Columns, int32 Rows, TArray<bool>& OutInside)
 {
-	// Ray casting algorithm for point-in-polygon detection
-	bool bInsidePolygon = false;
-	int32 j = PolygonPoints.Num() - 1;
+	OutInside.Init(false, Columns * Rows);
+	
+	TArray<double> Crossings;
+	Crossings.Reserve(PolygonPoints.Num());
+	int32 TotalCrossings = 0;
 	
-	for (int32 i = 0; i < PolygonPoints.Num(); i++)
+	for (int32 Row = 0; Row < Rows; Row++)
 	{
-		if (((PolygonPoints[i].Y > Point.Y) != (PolygonPoints[j].Y > Point.Y)) &&
-			(Point.X < (PolygonPoints[j].X - PolygonPoints[i].X) * (Point.Y - PolygonPoints[i].Y) / (PolygonPoints[j].Y - PolygonPoints[i].Y) + PolygonPoints[i].X))
+		const double ScanZ = StartZ + (Row * Step);
+		
+		// Edge-crossing table for this scanline - same half-open rule as ray casting, so vertices are counted once
+		Crossings.Reset();
+		for (int32 i = 0, j = PolygonPoints.Num() - 1; i < PolygonPoints.Num(); j = i++)
+		{
+			const FVector2D& A = PolygonPoints[i];
+			const FVector2D& B = PolygonPoints[j];
+			if ((A.Y > ScanZ) != (B.Y > ScanZ))
+			{
+				Crossings.Add((B.X - A.X) * (ScanZ - A.Y) / (B.Y - A.Y) + A.X);
+			}
+		}
+		if (Crossings.Num() == 0)
+		{
+			continue; // Row misses the polygon entirely
+		}
+		Crossings.Sort();
+		TotalCrossings += Crossings.Num();
+		
+		// Sweep left to right: a sample is inside when an odd number of crossings lies to its right
+		int32 NextCrossing = 0;
+		for (int32 Column = 0; Column < Columns; Column++)
 		{
-			bInsidePolygon = !bInsidePolygon;
+			const double SampleX = StartX + (Column * Step);
+			while (NextCrossing < Crossings.Num() && Crossings[NextCrossing] <= SampleX)
+			{
+				NextCrossing++;
+			}
+			if (NextCrossing == Crossings.Num())
+			{
+				break; // Rest of the row is right of the polygon
+			}
+			OutInside[(Row * Columns) + Column] = ((Crossings.Num() - NextCrossing) & 1) != 0;
 		}
-		j = i;
 	}
 	
-	return bInsidePolygon;
+	return TotalCrossings;
 }
 
-TArray<FVector2D> UHoleGenerator::GenerateIrregularPolygon(const FDoorConfig& Door, float BaseSizeCm)
+TArray<FVector2D> UHoleGenerator::GenerateIrregularPolygon(const FResolvedHole& Hole)
 {
 	// Set up deterministic random generator using the provided seed
-	FRandomStream RandomStream(Door.RandomSeed);
+	FRandomStream RandomStream(Hole.Seed);
+	const float BaseSizeCm = Hole.PolygonSizeCm;
 	
 	// Generate random points for irregular polygon
 	TArray<FVector2D> BasePoints;
-	float AngleStep = 2.0f * PI / Door.IrregularPoints;
+	float AngleStep = 2.0f * PI / Hole.PolygonPoints;
 	
-	for (int32 i = 0; i < Door.IrregularPoints; i++)
+	for (int32 i = 0; i < Hole.PolygonPoints; i++)
 	{
 		float Angle = i * AngleStep;
 		
@@ -390,12 +824,12 @@ TArray<FVector2D> UHoleGenerator::GenerateIrregularPolygon(const FDoorConfig& Do
 		
 		// Add random variation based on irregularity factor
 		float RandomRadius = RandomStream.FRandRange(
-			BaseSizeCm * (1.0f - Door.Irregularity), 
-			BaseSizeCm * (1.0f + Door.Irregularity)
+			BaseSizeCm * (1.0f - Hole.Irregularity), 
+			BaseSizeCm * (1.0f + Hole.Irregularity)
 		);
 		
 		// Random angle offset for more chaos
-		float AngleOffset = RandomStream.FRandRange(-Door.Irregularity * 0.5f, Door.Irregularity * 0.5f);
+		float AngleOffset = RandomStream.FRandRange(-Hole.Irregularity * 0.5f, Hole.Irregularity * 0.5f);
 		float FinalAngle = Angle + AngleOffset;
 		
 		FVector2D Point(
@@ -409,14 +843,14 @@ TArray<FVector2D> UHoleGenerator::GenerateIrregularPolygon(const FDoorConfig& Do
 	// Apply smoothness by adding interpolated points between base points
 	TArray<FVector2D> IrregularPoints;
 	
-	if (Door.IrregularSmoothness <= 0.0f)
+	if (Hole.Smoothness <= 0.0f)
 	{
 		// No smoothness - return original points
 		return BasePoints;
 	}
 	
 	// Calculate number of interpolation points based on smoothness
-	int32 InterpPointsPerSegment = FMath::RoundToInt(Door.IrregularSmoothness * 4.0f); // 0-4 points between each base point
+	int32 InterpPointsPerSegment = FMath::RoundToInt(Hole.Smoothness * 4.0f); // 0-4 points between each base point
 	
 	for (int32 i = 0; i < BasePoints.Num(); i++)
 	{
@@ -441,9 +875,9 @@ TArray<FVector2D> UHoleGenerator::GenerateIrregularPolygon(const FDoorConfig& Do
 	}
 	
 	// Apply rotation if specified
-	if (Door.IrregularRotation != 0.0f)
+	if (Hole.RotationDeg != 0.0f)
 	{
-		float RotationRadians = FMath::DegreesToRadians(Door.IrregularRotation);
+		float RotationRadians = FMath::DegreesToRadians(Hole.RotationDeg);
 		float CosRot = FMath::Cos(RotationRadians);
 		float SinRot = FMath::Sin(RotationRadians);
 		
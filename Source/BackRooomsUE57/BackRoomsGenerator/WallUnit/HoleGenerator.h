@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "WallCommon.h"
+#include "HoleDescriptor.h"
 
 /**
  * Universal hole generator that handles all hole types:
@@ -15,12 +16,33 @@ public:
 	static void GenerateWallWithHole(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
 		FVector InnerBL, FVector InnerBR, FVector InnerTR, FVector InnerTL,
 		FVector OuterBL, FVector OuterBR, FVector OuterTR, FVector OuterTL,
-		float WallWidth, float WallHeight, const FDoorConfig& Door, float WallThickness);
+		float WallWidth, float WallHeight, const FResolvedHole& Hole, float WallThickness);
+
+	// Solid parts of a polygon-hole wall as rectangles in wall space (cm from the bottom-left corner) for simple collision
+	// Strips around the hole bounds plus a coarse cell grid inside them; a cell only counts as solid if the hole does not touch it
+	static void GenerateCollisionRects(float WallWidth, float WallHeight, const FResolvedHole& Hole, TArray<FBox2D>& OutSolidRects);
 
 private:
-	// Ray casting point-in-polygon detection
-	static bool IsPointInIrregularPolygon(const FVector2D& Point, const TArray<FVector2D>& PolygonPoints);
+	// Exact wall: the wall rectangle with the hole polygon (wall-space cm) as an inner ring, ear-clipped,
+	// plus the hole rim and outer edges for thickness. Returns false (nothing emitted) if the hole
+	// touches the wall edge or self-intersects - the cell grid handles those
+	static bool GenerateTriangulatedWallWithHole(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
+		FVector InnerBL, FVector InnerBR, FVector InnerTL, FVector OuterBL, FVector OuterBR, FVector OuterTL,
+		float WallWidthCm, float WallHeightCm, const TArray<FVector2D>& HolePoints, float WallThickness);
+	
+	// Ear clipping for a simple counter-clockwise polygon (duplicate bridge vertices allowed)
+	// Appends counter-clockwise index triples into Polygon; false if the polygon could not be fully clipped
+	static bool TriangulatePolygon(const TArray<FVector2D>& Polygon, TArray<int32>& OutTriangles);
+	
+	// True if no two non-adjacent edges of the closed polygon cross
+	static bool IsSimplePolygon(const TArray<FVector2D>& PolygonPoints);
+	
+	// Scanline point-in-polygon classification for a lattice of sample points (StartX + Column * Step, StartZ + Row * Step)
+	// Each row's polygon edge crossings are computed and sorted once, then all samples in the row are swept
+	// Returns the number of edge crossings processed
+	static int32 RasterizePolygonInside(const TArray<FVector2D>& PolygonPoints, float StartX, float StartZ, float Step,
+		int32 Columns, int32 Rows, TArray<bool>& OutInside);
 	
 	// Generate random polygon points
-	static TArray<FVector2D> GenerateIrregularPolygon(const FDoorConfig& Door, float BaseSizeCm);
+	static TArray<FVector2D> GenerateIrregularPolygon(const FResolvedHole& Hole);
 };
\ No newline at end of file
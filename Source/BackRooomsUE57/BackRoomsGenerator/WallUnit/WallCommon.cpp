@@ -1,6 +1,39 @@
 #include "WallCommon.h"
 #include "../Main.h"  // For log category
 
+UWallCommon::FReservedEmit::FReservedEmit(TArray<FVector>& InVertices, TArray<int32>& InTriangles, TArray<FVector>& InNormals, TArray<FVector2D>& InUVs,
+	int32 NumVertices, int32 NumIndices, const TCHAR* InBuilderName)
+	: Vertices(InVertices)
+	, Triangles(InTriangles)
+	, Normals(InNormals)
+	, UVs(InUVs)
+	, BuilderName(InBuilderName)
+	, ExpectedVertices(InVertices.Num() + NumVertices)
+	, ExpectedIndices(InTriangles.Num() + NumIndices)
+{
+	Vertices.Reserve(ExpectedVertices);
+	Triangles.Reserve(ExpectedIndices);
+	Normals.Reserve(ExpectedVertices);
+	UVs.Reserve(ExpectedVertices);
+	
+	VertexData = Vertices.GetData();
+	TriangleData = Triangles.GetData();
+	NormalData = Normals.GetData();
+	UVData = UVs.GetData();
+}
+
+UWallCommon::FReservedEmit::~FReservedEmit()
+{
+#if DO_CHECK
+	// A wrong count either reallocates (too low) or leaves the prediction out of step with the builder (too high)
+	ensureMsgf(Vertices.Num() == ExpectedVertices && Triangles.Num() == ExpectedIndices,
+		TEXT("%s emitted %d vertices / %d indices, size pass predicted %d / %d"),
+		BuilderName, Vertices.Num(), Triangles.Num(), ExpectedVertices, ExpectedIndices);
+	ensureMsgf(Vertices.GetData() == VertexData && Triangles.GetData() == TriangleData && Normals.GetData() == NormalData && UVs.GetData() == UVData,
+		TEXT("%s reallocated a mesh buffer during emission"), BuilderName);
+#endif
+}
+
 // Optimized helper function for quad face generation
 void UWallCommon::AddQuadFace(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs, const FFaceData& Face)
 {
@@ -46,6 +79,19 @@ void UWallCommon::AddQuadFace(TArray<FVector>& Vertices, TArray<int32>& Triangle
 	}
 }
 
+void UWallCommon::AddOutwardQuadFace(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs, FFaceData Face)
+{
+	if (Face.Vertices.Num() != 4)
+	{
+		return; // Invalid face data
+	}
+	
+	// Front side of triangle (0, 1, 2) is along (V1 - V0) x (V2 - V0)
+	const FVector WindingNormal = FVector::CrossProduct(Face.Vertices[1] - Face.Vertices[0], Face.Vertices[2] - Face.Vertices[0]);
+	Face.bReverseWinding = FVector::DotProduct(WindingNormal, Face.Normal) < 0.0f;
+	AddQuadFace(Vertices, Triangles, Normals, UVs, Face);
+}
+
 void UWallCommon::AddDoorFrame(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
 	FVector InnerV1, FVector OuterV1, FVector OuterV2, FVector InnerV2, float FrameThickness, float FrameSize)
 {
@@ -87,6 +133,9 @@ void UWallCommon::GenerateThickWallSegment(TArray<FVector>& Vertices, TArray<int
 	
 	float ThicknessUV = WallThickness;
 	
+	FReservedEmit Emit(Vertices, Triangles, Normals, UVs,
+		ThickWallSegmentQuads * VerticesPerQuad, ThickWallSegmentQuads * IndicesPerQuad, TEXT("GenerateThickWallSegment"));
+	
 	// Create all faces using shared utilities
 	TArray<FFaceData> AllFaces;
 	AllFaces.Reserve(6); // Inner, Outer, Bottom, Top, Left, Right
@@ -126,7 +175,7 @@ void UWallCommon::GenerateThickWallSegment(TArray<FVector>& Vertices, TArray<int
 	// === LEFT SIDE FACE ===
 	FFaceData LeftFace;
 	LeftFace.Vertices = {InnerTL, OuterTL, OuterBL, InnerBL};
-	LeftFace.Normal = (OuterBL - InnerBL).GetSafeNormal();
+	LeftFace.Normal = (InnerBL - InnerBR).GetSafeNormal();
 	LeftFace.UVs = {FVector2D(0, SegmentHeight), FVector2D(ThicknessUV, SegmentHeight), FVector2D(ThicknessUV, 0), FVector2D(0, 0)};
 	LeftFace.bReverseWinding = false;
 	AllFaces.Add(LeftFace);
@@ -134,9 +183,9 @@ void UWallCommon::GenerateThickWallSegment(TArray<FVector>& Vertices, TArray<int
 	// === RIGHT SIDE FACE ===
 	FFaceData RightFace;
 	RightFace.Vertices = {InnerBR, OuterBR, OuterTR, InnerTR};
-	RightFace.Normal = (OuterBR - InnerBR).GetSafeNormal();
+	RightFace.Normal = (InnerBR - InnerBL).GetSafeNormal();
 	RightFace.UVs = {FVector2D(0, 0), FVector2D(ThicknessUV, 0), FVector2D(ThicknessUV, SegmentHeight), FVector2D(0, SegmentHeight)};
-	RightFace.bReverseWinding = true; // Special winding for right face
+	RightFace.bReverseWinding = false; // (BR, OuterBR, OuterTR) already winds outward
 	AllFaces.Add(RightFace);
 	
 	// Generate all faces using shared utility
@@ -144,4 +193,182 @@ void UWallCommon::GenerateThickWallSegment(TArray<FVector>& Vertices, TArray<int
 	{
 		AddQuadFace(Vertices, Triangles, Normals, UVs, Face);
 	}
-}
\ No newline at end of file
+}
+
+void UWallCommon::GenerateThickWallFrame(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
+	FVector InnerBL, FVector InnerBR, FVector InnerTR, FVector InnerTL,
+	FVector OuterBL, FVector OuterBR, FVector OuterTR, FVector OuterTL,
+	float HoleLeft, float HoleRight, float HoleBottom, float HoleTop, float WallThickness)
+{
+	const FVector WidthDir = (InnerBR - InnerBL).GetSafeNormal();
+	const FVector HeightDir = (InnerTL - InnerBL).GetSafeNormal();
+	const FVector OuterWidthDir = (OuterBR - OuterBL).GetSafeNormal();
+	const FVector OuterHeightDir = (OuterTL - OuterBL).GetSafeNormal();
+	const FVector InnerNormal = (InnerBL - OuterBL).GetSafeNormal();
+	const float WidthCm = FVector::Dist(InnerBL, InnerBR);
+	const float HeightCm = FVector::Dist(InnerBL, InnerTL);
+	const float ThicknessUV = WallThickness;
+	
+	const int32 NumQuads = CountThickWallFrameQuads(WidthCm, HeightCm, HoleLeft, HoleRight, HoleBottom, HoleTop);
+	FReservedEmit Emit(Vertices, Triangles, Normals, UVs, NumQuads * VerticesPerQuad, NumQuads * IndicesPerQuad, TEXT("GenerateThickWallFrame"));
+	
+	SnapFrameOpening(WidthCm, HeightCm, HoleLeft, HoleRight, HoleBottom, HoleTop);
+	const bool bSolidLeft = HoleLeft > 0.0f;
+	const bool bSolidRight = HoleRight < WidthCm;
+	const bool bSolidBottom = HoleBottom > 0.0f;
+	const bool bSolidTop = HoleTop < HeightCm;
+	
+	auto InnerPoint = [&](float U, float V) { return InnerBL + (WidthDir * U) + (HeightDir * V); };
+	auto OuterPoint = [&](float U, float V) { return OuterBL + (OuterWidthDir * U) + (OuterHeightDir * V); };
+	
+	// Inner and outer face of one rectangle of the wall surface (wall-space UVs in meters)
+	auto AddSurface = [&](float U0, float V0, float U1, float V1)
+	{
+		FFaceData Face;
+		Face.UVs = {FVector2D(U0, V0) / 100.0f, FVector2D(U1, V0) / 100.0f, FVector2D(U1, V1) / 100.0f, FVector2D(U0, V1) / 100.0f};
+		
+		Face.Vertices = {InnerPoint(U0, V0), InnerPoint(U1, V0), InnerPoint(U1, V1), InnerPoint(U0, V1)};
+		Face.Normal = InnerNormal;
+		AddOutwardQuadFace(Vertices, Triangles, Normals, UVs, Face);
+		
+		Face.Vertices = {OuterPoint(U0, V0), OuterPoint(U1, V0), OuterPoint(U1, V1), OuterPoint(U0, V1)};
+		Face.Normal = -InnerNormal;
+		AddOutwardQuadFace(Vertices, Triangles, Normals, UVs, Face);
+	};
+	
+	// Thickness face along the wall-space segment A-B (outer edges and opening rim)
+	auto AddEdge = [&](const FVector2D& A, const FVector2D& B, const FVector& Normal)
+	{
+		const float Length = FVector2D::Distance(A, B) / 100.0f;
+		FFaceData Face;
+		Face.Vertices = {InnerPoint(A.X, A.Y), InnerPoint(B.X, B.Y), OuterPoint(B.X, B.Y), OuterPoint(A.X, A.Y)};
+		Face.Normal = Normal;
+		Face.UVs = {FVector2D(0, 0), FVector2D(Length, 0), FVector2D(Length, ThicknessUV), FVector2D(0, ThicknessUV)};
+		AddOutwardQuadFace(Vertices, Triangles, Normals, UVs, Face);
+	};
+	
+	// === WALL SURFACE: full-width strips below/above the opening, side strips beside it ===
+	if (bSolidBottom) AddSurface(0.0f, 0.0f, WidthCm, HoleBottom);
+	if (bSolidTop) AddSurface(0.0f, HoleTop, WidthCm, HeightCm);
+	if (bSolidLeft) AddSurface(0.0f, HoleBottom, HoleLeft, HoleTop);
+	if (bSolidRight) AddSurface(HoleRight, HoleBottom, WidthCm, HoleTop);
+	
+	// === OUTER EDGES: split where the opening reaches the edge ===
+	if (bSolidBottom)
+	{
+		AddEdge(FVector2D(0.0f, 0.0f), FVector2D(WidthCm, 0.0f), -HeightDir);
+	}
+	else
+	{
+		if (bSolidLeft) AddEdge(FVector2D(0.0f, 0.0f), FVector2D(HoleLeft, 0.0f), -HeightDir);
+		if (bSolidRight) AddEdge(FVector2D(HoleRight, 0.0f), FVector2D(WidthCm, 0.0f), -HeightDir);
+	}
+	
+	if (bSolidTop)
+	{
+		AddEdge(FVector2D(0.0f, HeightCm), FVector2D(WidthCm, HeightCm), HeightDir);
+	}
+	else
+	{
+		if (bSolidLeft) AddEdge(FVector2D(0.0f, HeightCm), FVector2D(HoleLeft, HeightCm), HeightDir);
+		if (bSolidRight) AddEdge(FVector2D(HoleRight, HeightCm), FVector2D(WidthCm, HeightCm), HeightDir);
+	}
+	
+	if (bSolidLeft)
+	{
+		AddEdge(FVector2D(0.0f, 0.0f), FVector2D(0.0f, HeightCm), -WidthDir);
+	}
+	else
+	{
+		if (bSolidBottom) AddEdge(FVector2D(0.0f, 0.0f), FVector2D(0.0f, HoleBottom), -WidthDir);
+		if (bSolidTop) AddEdge(FVector2D(0.0f, HoleTop), FVector2D(0.0f, HeightCm), -WidthDir);
+	}
+	
+	if (bSolidRight)
+	{
+		AddEdge(FVector2D(WidthCm, 0.0f), FVector2D(WidthCm, HeightCm), WidthDir);
+	}
+	else
+	{
+		if (bSolidBottom) AddEdge(FVector2D(WidthCm, 0.0f), FVector2D(WidthCm, HoleBottom), WidthDir);
+		if (bSolidTop) AddEdge(FVector2D(WidthCm, HoleTop), FVector2D(WidthCm, HeightCm), WidthDir);
+	}
+	
+	// === OPENING RIM: faces point into the opening ===
+	if (bSolidLeft) AddEdge(FVector2D(HoleLeft, HoleBottom), FVector2D(HoleLeft, HoleTop), WidthDir);
+	if (bSolidRight) AddEdge(FVector2D(HoleRight, HoleBottom), FVector2D(HoleRight, HoleTop), -WidthDir);
+	if (bSolidBottom) AddEdge(FVector2D(HoleLeft, HoleBottom), FVector2D(HoleRight, HoleBottom), HeightDir);
+	if (bSolidTop) AddEdge(FVector2D(HoleLeft, HoleTop), FVector2D(HoleRight, HoleTop), -HeightDir);
+}
+
+void UWallCommon::SnapFrameOpening(float WidthCm, float HeightCm, float& HoleLeft, float& HoleRight, float& HoleBottom, float& HoleTop)
+{
+	HoleLeft = HoleLeft > 1.0f ? HoleLeft : 0.0f;
+	HoleBottom = HoleBottom > 1.0f ? HoleBottom : 0.0f;
+	HoleRight = (WidthCm - HoleRight) > 1.0f ? HoleRight : WidthCm;
+	HoleTop = (HeightCm - HoleTop) > 1.0f ? HoleTop : HeightCm;
+}
+
+int32 UWallCommon::CountThickWallFrameQuads(float WidthCm, float HeightCm, float HoleLeft, float HoleRight, float HoleBottom, float HoleTop)
+{
+	SnapFrameOpening(WidthCm, HeightCm, HoleLeft, HoleRight, HoleBottom, HoleTop);
+	const int32 L = HoleLeft > 0.0f;
+	const int32 R = HoleRight < WidthCm;
+	const int32 B = HoleBottom > 0.0f;
+	const int32 T = HoleTop < HeightCm;
+	
+	// Surfaces: inner + outer per solid side; rim: one per solid side
+	// Outer edges: whole when that side is solid, otherwise split around the opening
+	const int32 Surfaces = 2 * (L + R + B + T);
+	const int32 Rim = L + R + B + T;
+	const int32 Edges = (B ? 1 : L + R) + (T ? 1 : L + R) + (L ? 1 : B + T) + (R ? 1 : B + T);
+	return Surfaces + Edges + Rim;
+}
+
+bool UWallCommon::ValidateClosedMesh(const TArray<FVector>& Vertices, const TArray<int32>& Triangles, FString& OutError)
+{
+	if (Triangles.Num() == 0 || Triangles.Num() % 3 != 0)
+	{
+		OutError = FString::Printf(TEXT("%d triangle indices"), Triangles.Num());
+		return false;
+	}
+	
+	// Accumulate relative to the first vertex to keep world-space walls precise
+	const FVector Origin = Vertices.Num() > 0 ? Vertices[0] : FVector::ZeroVector;
+	FVector AreaSum = FVector::ZeroVector; // Sum of (2 x area) weighted normals
+	double TotalArea = 0.0;                 // Sum of 2 x area
+	double Volume = 0.0;                    // 6 x signed volume
+	
+	for (int32 i = 0; i < Triangles.Num(); i += 3)
+	{
+		const int32 I0 = Triangles[i], I1 = Triangles[i + 1], I2 = Triangles[i + 2];
+		if (!Vertices.IsValidIndex(I0) || !Vertices.IsValidIndex(I1) || !Vertices.IsValidIndex(I2))
+		{
+			OutError = FString::Printf(TEXT("triangle %d references a missing vertex"), i / 3);
+			return false;
+		}
+		
+		const FVector A = Vertices[I0] - Origin;
+		const FVector B = Vertices[I1] - Origin;
+		const FVector C = Vertices[I2] - Origin;
+		const FVector Cross = FVector::CrossProduct(B - A, C - A);
+		AreaSum += Cross;
+		TotalArea += Cross.Size();
+		Volume += FVector::DotProduct(A, FVector::CrossProduct(B, C));
+	}
+	
+	// A missing or flipped face leaves its area uncancelled
+	if (AreaSum.Size() > TotalArea * 1e-4)
+	{
+		OutError = FString::Printf(TEXT("open surface (normal imbalance %.1f cm2 of %.1f cm2)"), AreaSum.Size() * 0.5, TotalArea * 0.5);
+		return false;
+	}
+	
+	if (Volume <= 0.0)
+	{
+		OutError = FString::Printf(TEXT("faces point inward (signed volume %.1f cm3)"), Volume / 6.0);
+		return false;
+	}
+	
+	return true;
+}
@@ -20,9 +20,44 @@ public:
 		FFaceData() { Vertices.Reserve(4); UVs.Reserve(4); }
 	};
 
+	// Exact-size emission: reserves room for a known number of vertices and indices up front, and in builds with
+	// checks enabled verifies on destruction that exactly that much was emitted without any buffer reallocating
+	struct FReservedEmit
+	{
+		FReservedEmit(TArray<FVector>& InVertices, TArray<int32>& InTriangles, TArray<FVector>& InNormals, TArray<FVector2D>& InUVs,
+			int32 NumVertices, int32 NumIndices, const TCHAR* InBuilderName);
+		~FReservedEmit();
+		
+	private:
+		TArray<FVector>& Vertices;
+		TArray<int32>& Triangles;
+		TArray<FVector>& Normals;
+		TArray<FVector2D>& UVs;
+		const TCHAR* BuilderName;
+		int32 ExpectedVertices;
+		int32 ExpectedIndices;
+		const void* VertexData;
+		const void* TriangleData;
+		const void* NormalData;
+		const void* UVData;
+	};
+	
+	// Every quad helper below emits 4 vertices (with normals and UVs) and 6 triangle indices
+	static constexpr int32 VerticesPerQuad = 4;
+	static constexpr int32 IndicesPerQuad = 6;
+	
+	// Quads emitted by GenerateThickWallSegment: inner, outer and the four edges
+	static constexpr int32 ThickWallSegmentQuads = 6;
+	
+	// Quads GenerateThickWallFrame emits for an opening (same arguments in cm, same edge snapping)
+	static int32 CountThickWallFrameQuads(float WidthCm, float HeightCm, float HoleLeft, float HoleRight, float HoleBottom, float HoleTop);
+
 	// Optimized helper functions
 	static void AddQuadFace(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs, const FFaceData& Face);
 	
+	// Same as AddQuadFace, but picks the winding so the triangles face along Face.Normal (bReverseWinding is ignored)
+	static void AddOutwardQuadFace(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs, FFaceData Face);
+	
 	// Helper function for door frames
 	static void AddDoorFrame(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
 		FVector InnerV1, FVector OuterV1, FVector OuterV2, FVector InnerV2, float FrameThickness, float FrameSize);
@@ -32,4 +67,20 @@ public:
 		FVector InnerBL, FVector InnerBR, FVector InnerTR, FVector InnerTL,
 		FVector OuterBL, FVector OuterBR, FVector OuterTR, FVector OuterTL,
 		float SegmentWidth, float SegmentHeight, float WallThickness);
+	
+	// Closed thick wall around one rectangular opening (hole bounds in cm from the wall's bottom-left corner)
+	// Emits only the outside surface: both wall faces, the outer edges and the opening's rim - no internal faces
+	static void GenerateThickWallFrame(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
+		FVector InnerBL, FVector InnerBR, FVector InnerTR, FVector InnerTL,
+		FVector OuterBL, FVector OuterBR, FVector OuterTR, FVector OuterTL,
+		float HoleLeft, float HoleRight, float HoleBottom, float HoleTop, float WallThickness);
+	
+	// Check that a single-sided mesh is a closed, outward-facing solid (no missing or flipped faces)
+	// Area-weighted face normals of a closed surface cancel out and its signed volume is positive;
+	// T-junctions between coplanar quads are fine
+	static bool ValidateClosedMesh(const TArray<FVector>& Vertices, const TArray<int32>& Triangles, FString& OutError);
+
+private:
+	// Openings within 1cm of a wall edge are snapped to it, so the edge face is split instead of leaving a sliver
+	static void SnapFrameOpening(float WidthCm, float HeightCm, float& HoleLeft, float& HoleRight, float& HoleBottom, float& HoleTop);
 };
\ No newline at end of file
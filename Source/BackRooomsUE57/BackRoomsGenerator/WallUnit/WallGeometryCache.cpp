@@ -0,0 +1,197 @@
+#include "WallGeometryCache.h"
+#include "WallUnit.h"
+#include "WallCommon.h"
+#include "WallTransform.h"
+#include "../Main.h"  // For log category
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	// Everything that determines a wall's local-space geometry
+	struct FWallGeometryKey
+	{
+		float Width = 0.0f;
+		float Height = 0.0f;
+		float Thickness = 0.0f;
+		bool bHasHole = false;
+		FResolvedHole Hole;
+
+		bool operator==(const FWallGeometryKey& Other) const
+		{
+			return Width == Other.Width && Height == Other.Height && Thickness == Other.Thickness
+				&& bHasHole == Other.bHasHole && (!bHasHole || Hole == Other.Hole);
+		}
+
+		friend uint32 GetTypeHash(const FWallGeometryKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.Width), GetTypeHash(Key.Height));
+			Hash = HashCombine(Hash, GetTypeHash(Key.Thickness));
+			return Key.bHasHole ? HashCombine(Hash, GetTypeHash(Key.Hole)) : Hash;
+		}
+	};
+
+	// Random-seeded irregular holes never repeat, so bound the cache instead of letting them pile up
+	// A full cache drops its least recently used quarter, so the walls a layout keeps repeating stay cached
+	constexpr int32 MaxCachedWalls = 512;
+	constexpr int32 EvictedWalls = MaxCachedWalls / 4;
+
+	struct FCachedWall
+	{
+		FWallGeometryRef Geometry;
+		uint64 LastUse = 0;
+
+		FCachedWall(const FWallGeometryRef& InGeometry, uint64 InLastUse) : Geometry(InGeometry), LastUse(InLastUse) {}
+	};
+
+	struct FWallGeometryCacheState
+	{
+		FCriticalSection Lock;
+		TMap<FWallGeometryKey, FCachedWall> Entries;
+		uint64 UseCounter = 0;
+		int32 Hits = 0;
+		int32 Misses = 0;
+		int64 BytesSaved = 0;
+	};
+
+	FWallGeometryCacheState& GetCacheState()
+	{
+		static FWallGeometryCacheState State;
+		return State;
+	}
+}
+
+FWallGeometryRef UWallGeometryCache::FindOrBuild(float WallWidth, float WallHeight, float WallThickness, const FResolvedHole* Hole)
+{
+	FWallGeometryKey Key;
+	Key.Width = WallWidth;
+	Key.Height = WallHeight;
+	Key.Thickness = WallThickness;
+	Key.bHasHole = Hole != nullptr;
+	if (Hole)
+	{
+		Key.Hole = *Hole;
+	}
+
+	FWallGeometryCacheState& State = GetCacheState();
+	{
+		FScopeLock ScopeLock(&State.Lock);
+		if (FCachedWall* Cached = State.Entries.Find(Key))
+		{
+			State.Hits++;
+			State.BytesSaved += Cached->Geometry->GetAllocatedSize();
+			Cached->LastUse = ++State.UseCounter;
+			return Cached->Geometry;
+		}
+	}
+
+	// Build outside the lock in wall-local space (no debug draw - callers handle that per placement)
+	TSharedRef<FWallGeometry, ESPMode::ThreadSafe> Geometry = MakeShared<FWallGeometry, ESPMode::ThreadSafe>();
+	if (Hole)
+	{
+		UWallUnit::GenerateWallMeshWithResolvedHole(Geometry->Vertices, Geometry->Triangles, Geometry->Normals, Geometry->UVs,
+			FVector::ZeroVector, FRotator::ZeroRotator, WallWidth, WallHeight, WallThickness, *Hole, nullptr);
+	}
+	else
+	{
+		UWallUnit::GenerateSolidWallMesh(Geometry->Vertices, Geometry->Triangles, Geometry->Normals, Geometry->UVs,
+			FVector::ZeroVector, FRotator::ZeroRotator, WallWidth, WallHeight, WallThickness, nullptr);
+	}
+	UWallUnit::GenerateCollisionBoxes(WallWidth, WallHeight, WallThickness, Hole, Geometry->CollisionBoxes);
+
+#if !UE_BUILD_SHIPPING
+	// Walls are single-sided closed solids - a missing or inward face would show as a see-through gap
+	FString MeshError;
+	if (!UWallCommon::ValidateClosedMesh(Geometry->Vertices, Geometry->Triangles, MeshError))
+	{
+		UE_LOG(LogBackRoomGenerator, Warning, TEXT("Wall mesh %.2fx%.2fx%.2fm (%s) is not a closed solid: %s"),
+			WallWidth, WallHeight, WallThickness, Hole ? TEXT("with hole") : TEXT("solid"), *MeshError);
+	}
+#endif
+
+	FScopeLock ScopeLock(&State.Lock);
+	State.Misses++;
+	if (State.Entries.Num() >= MaxCachedWalls)
+	{
+		// Use stamps are unique, so everything older than the EvictedWalls-th oldest goes
+		TArray<uint64> Uses;
+		Uses.Reserve(State.Entries.Num());
+		for (const TPair<FWallGeometryKey, FCachedWall>& Entry : State.Entries)
+		{
+			Uses.Add(Entry.Value.LastUse);
+		}
+		Uses.Sort();
+		const uint64 OldestKept = Uses[EvictedWalls];
+		for (auto It = State.Entries.CreateIterator(); It; ++It)
+		{
+			if (It.Value().LastUse < OldestKept)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+	return State.Entries.Add(Key, FCachedWall(Geometry, ++State.UseCounter)).Geometry;
+}
+
+void UWallGeometryCache::ApplyTransform(const FWallGeometry& Geometry, const FVector& Position, const FRotator& Rotation,
+	TArray<FVector>& OutVertices, TArray<int32>& OutTriangles, TArray<FVector>& OutNormals, TArray<FVector2D>& OutUVs)
+{
+	OutVertices.Reset();
+	OutNormals.Reset();
+	UWallTransform::AppendTransformed(FTransform(Rotation, Position), Geometry.Vertices, Geometry.Normals, OutVertices, OutNormals);
+
+	// Topology and UVs are placement-independent
+	OutTriangles = Geometry.Triangles;
+	OutUVs = Geometry.UVs;
+}
+
+void UWallGeometryCache::TransformCollision(const FWallGeometry& Geometry, const FVector& Position, const FRotator& Rotation,
+	TArray<TArray<FVector>>& OutCollisionHulls)
+{
+	const FTransform WallTransform(Rotation, Position);
+
+	OutCollisionHulls.SetNum(Geometry.CollisionBoxes.Num());
+	for (int32 BoxIndex = 0; BoxIndex < Geometry.CollisionBoxes.Num(); BoxIndex++)
+	{
+		const FBox& Box = Geometry.CollisionBoxes[BoxIndex];
+		TArray<FVector>& Hull = OutCollisionHulls[BoxIndex];
+		Hull.SetNumUninitialized(8);
+		for (int32 Corner = 0; Corner < 8; Corner++)
+		{
+			Hull[Corner] = FVector((Corner & 1) ? Box.Max.X : Box.Min.X, (Corner & 2) ? Box.Max.Y : Box.Min.Y, (Corner & 4) ? Box.Max.Z : Box.Min.Z);
+		}
+		UWallTransform::TransformPositions(WallTransform, Hull.GetData(), Hull.GetData(), Hull.Num());
+	}
+}
+
+void UWallGeometryCache::GetStats(int32& OutHits, int32& OutMisses, int32& OutEntries, int64& OutBytesSaved)
+{
+	FWallGeometryCacheState& State = GetCacheState();
+	FScopeLock ScopeLock(&State.Lock);
+	OutHits = State.Hits;
+	OutMisses = State.Misses;
+	OutEntries = State.Entries.Num();
+	OutBytesSaved = State.BytesSaved;
+}
+
+void UWallGeometryCache::LogStats()
+{
+	int32 Hits, Misses, Entries;
+	int64 BytesSaved;
+	GetStats(Hits, Misses, Entries, BytesSaved);
+
+	const int32 Lookups = Hits + Misses;
+	const float HitRate = Lookups > 0 ? (100.0f * Hits) / Lookups : 0.0f;
+	UE_LOG(LogBackRoomGenerator, Log, TEXT("Wall geometry cache: %d/%d hits (%.1f%%), %d unique walls, %.1f KB not rebuilt"),
+		Hits, Lookups, HitRate, Entries, BytesSaved / 1024.0);
+}
+
+void UWallGeometryCache::Reset()
+{
+	FWallGeometryCacheState& State = GetCacheState();
+	FScopeLock ScopeLock(&State.Lock);
+	State.Entries.Empty();
+	State.UseCounter = 0;
+	State.Hits = 0;
+	State.Misses = 0;
+	State.BytesSaved = 0;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HoleDescriptor.h"
+
+// Immutable wall mesh in wall-local space (centered at origin, X = width, Y = thickness, Z = height)
+struct FWallGeometry
+{
+	TArray<FVector> Vertices;
+	TArray<int32> Triangles;
+	TArray<FVector> Normals;
+	TArray<FVector2D> UVs;
+
+	// Simple collision: the solid parts of the wall as boxes, same local space
+	TArray<FBox> CollisionBoxes;
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return Vertices.GetAllocatedSize() + Triangles.GetAllocatedSize() + Normals.GetAllocatedSize() + UVs.GetAllocatedSize()
+			+ CollisionBoxes.GetAllocatedSize();
+	}
+};
+
+typedef TSharedRef<const FWallGeometry, ESPMode::ThreadSafe> FWallGeometryRef;
+
+/**
+ * Content-addressed cache of wall meshes
+ * Walls with the same size, thickness and resolved hole share one local-space mesh;
+ * callers only apply their own rotation and position to it.
+ */
+class UWallGeometryCache
+{
+public:
+	// Shared local-space mesh for a wall (Hole == nullptr for a solid wall), built on first request
+	static FWallGeometryRef FindOrBuild(float WallWidth, float WallHeight, float WallThickness, const FResolvedHole* Hole);
+
+	// Copy a cached mesh into output buffers, rotated around the wall center and moved to Position
+	static void ApplyTransform(const FWallGeometry& Geometry, const FVector& Position, const FRotator& Rotation,
+		TArray<FVector>& OutVertices, TArray<int32>& OutTriangles, TArray<FVector>& OutNormals, TArray<FVector2D>& OutUVs);
+
+	// Collision boxes of a cached mesh as convex hulls (8 corners each), placed like ApplyTransform
+	static void TransformCollision(const FWallGeometry& Geometry, const FVector& Position, const FRotator& Rotation,
+		TArray<TArray<FVector>>& OutCollisionHulls);
+
+	// Cache statistics since the last Reset
+	static void GetStats(int32& OutHits, int32& OutMisses, int32& OutEntries, int64& OutBytesSaved);
+	static void LogStats();
+
+	// Drop all cached meshes and statistics
+	static void Reset();
+};
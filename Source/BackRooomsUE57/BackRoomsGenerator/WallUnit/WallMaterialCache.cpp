@@ -0,0 +1,88 @@
+#include "WallMaterialCache.h"
+#include "../Main.h"  // For log category
+#include "Materials/MaterialInstanceDynamic.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	// Instances are rooted while cached; weak pointers keep static destruction after UObject shutdown harmless
+	struct FWallMaterialCacheState
+	{
+		TWeakObjectPtr<UMaterialInterface> BaseMaterial;
+		TMap<uint32, TWeakObjectPtr<UMaterialInstanceDynamic>> Instances;
+		int32 Requests = 0;
+	};
+
+	FWallMaterialCacheState& GetCacheState()
+	{
+		static FWallMaterialCacheState State;
+		return State;
+	}
+}
+
+UMaterialInterface* UWallMaterialCache::GetColorMaterial(const FLinearColor& Color)
+{
+	check(IsInGameThread());
+	FWallMaterialCacheState& State = GetCacheState();
+	State.Requests++;
+
+	const uint32 ColorKey = Color.ToFColor(true).ToPackedARGB();
+	if (const TWeakObjectPtr<UMaterialInstanceDynamic>* Cached = State.Instances.Find(ColorKey))
+	{
+		if (UMaterialInstanceDynamic* CachedMat = Cached->Get())
+		{
+			return CachedMat;
+		}
+	}
+
+	if (!State.BaseMaterial.IsValid())
+	{
+		// Engine content - kept loaded by the engine, so a weak pointer is enough
+		State.BaseMaterial = LoadObject<UMaterialInterface>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial"));
+		if (!State.BaseMaterial.IsValid())
+		{
+			UE_LOG(LogBackRoomGenerator, Error, TEXT("Wall material cache: failed to load BasicShapeMaterial"));
+			return nullptr;
+		}
+	}
+
+	// Outer is the transient package, so an instance is not tied to whichever actor asked for it first
+	UMaterialInstanceDynamic* DynMat = UMaterialInstanceDynamic::Create(State.BaseMaterial.Get(), GetTransientPackage());
+	if (!DynMat)
+	{
+		return State.BaseMaterial.Get();
+	}
+	DynMat->SetVectorParameterValue(TEXT("Color"), Color);
+	DynMat->SetVectorParameterValue(TEXT("BaseColor"), Color);
+	DynMat->AddToRoot();
+	State.Instances.Add(ColorKey, DynMat);
+	return DynMat;
+}
+
+void UWallMaterialCache::GetStats(int32& OutRequests, int32& OutMaterials)
+{
+	const FWallMaterialCacheState& State = GetCacheState();
+	OutRequests = State.Requests;
+	OutMaterials = State.Instances.Num();
+}
+
+void UWallMaterialCache::LogStats()
+{
+	int32 Requests, Materials;
+	GetStats(Requests, Materials);
+	UE_LOG(LogBackRoomGenerator, Log, TEXT("Wall material cache: %d material requests served by %d shared instances"), Requests, Materials);
+}
+
+void UWallMaterialCache::Reset()
+{
+	FWallMaterialCacheState& State = GetCacheState();
+	for (const TPair<uint32, TWeakObjectPtr<UMaterialInstanceDynamic>>& Pair : State.Instances)
+	{
+		if (UMaterialInstanceDynamic* DynMat = Pair.Value.Get())
+		{
+			DynMat->RemoveFromRoot();
+		}
+	}
+	State.Instances.Empty();
+	State.Requests = 0;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UMaterialInterface;
+
+/**
+ * Generator-wide cache of flat-colored materials
+ * The basic shape material is loaded once and every distinct color gets one shared dynamic instance,
+ * so the number of material instances depends on the palette rather than on the number of rooms.
+ * Game thread only.
+ */
+class UWallMaterialCache
+{
+public:
+	// Shared material with Color/BaseColor set to Color (colors are matched at 8-bit precision)
+	static UMaterialInterface* GetColorMaterial(const FLinearColor& Color);
+
+	// Cache statistics since the last Reset
+	static void GetStats(int32& OutRequests, int32& OutMaterials);
+	static void LogStats();
+
+	// Release the cached instances (materials already assigned stay alive through their components)
+	static void Reset();
+};
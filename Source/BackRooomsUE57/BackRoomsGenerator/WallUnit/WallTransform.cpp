@@ -0,0 +1,147 @@
+#include "WallTransform.h"
+#include "../Main.h"  // For log category
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+static_assert(std::is_same_v<FVector::FReal, double>, "Wall transform kernels load FVector as three doubles");
+
+namespace
+{
+	// Rows of a row-vector matrix as registers: P' = P.X * Row0 + P.Y * Row1 + P.Z * Row2 + Row3
+	struct FTransformRows
+	{
+		VectorRegister4Double Row0;
+		VectorRegister4Double Row1;
+		VectorRegister4Double Row2;
+		VectorRegister4Double Row3;
+
+		explicit FTransformRows(const FMatrix& Matrix)
+			: Row0(VectorLoad(&Matrix.M[0][0]))
+			, Row1(VectorLoad(&Matrix.M[1][0]))
+			, Row2(VectorLoad(&Matrix.M[2][0]))
+			, Row3(VectorLoad(&Matrix.M[3][0]))
+		{
+		}
+	};
+
+	FORCEINLINE VectorRegister4Double TransformRow(const VectorRegister4Double& Point, const FTransformRows& Rows, const VectorRegister4Double& Offset)
+	{
+		VectorRegister4Double Result = VectorMultiplyAdd(VectorReplicate(Point, 0), Rows.Row0, Offset);
+		Result = VectorMultiplyAdd(VectorReplicate(Point, 1), Rows.Row1, Result);
+		return VectorMultiplyAdd(VectorReplicate(Point, 2), Rows.Row2, Result);
+	}
+}
+
+void UWallTransform::TransformPositions(const FTransform& Transform, const FVector* InPositions, FVector* OutPositions, int32 Count)
+{
+	const FTransformRows Rows(Transform.ToMatrixWithScale());
+	for (int32 i = 0; i < Count; i++)
+	{
+		// Load before store, so transforming in place is fine
+		const VectorRegister4Double Point = VectorLoadFloat3(&InPositions[i].X);
+		VectorStoreFloat3(TransformRow(Point, Rows, Rows.Row3), &OutPositions[i].X);
+	}
+}
+
+void UWallTransform::TransformNormals(const FTransform& Transform, const FVector* InNormals, FVector* OutNormals, int32 Count)
+{
+	// Rotation only - same as TransformVectorNoScale
+	const FTransformRows Rows(Transform.ToMatrixNoScale());
+	const VectorRegister4Double Zero = VectorZeroDouble();
+	for (int32 i = 0; i < Count; i++)
+	{
+		const VectorRegister4Double Normal = VectorLoadFloat3(&InNormals[i].X);
+		VectorStoreFloat3(TransformRow(Normal, Rows, Zero), &OutNormals[i].X);
+	}
+}
+
+void UWallTransform::AppendTransformed(const FTransform& Transform, const TArray<FVector>& Positions, const TArray<FVector>& Normals,
+	TArray<FVector>& OutPositions, TArray<FVector>& OutNormals)
+{
+	const int32 PositionOffset = OutPositions.AddUninitialized(Positions.Num());
+	TransformPositions(Transform, Positions.GetData(), OutPositions.GetData() + PositionOffset, Positions.Num());
+
+	const int32 NormalOffset = OutNormals.AddUninitialized(Normals.Num());
+	TransformNormals(Transform, Normals.GetData(), OutNormals.GetData() + NormalOffset, Normals.Num());
+}
+
+void UWallTransform::PlaceWallCorners(const FVector& Position, const FRotator& Rotation,
+	float WallWidth, float WallHeight, float WallThickness, FVector OutCorners[8])
+{
+	// Convert meters to Unreal units (cm)
+	const float HalfWidth = WallWidth * 100.0f * 0.5f;
+	const float HalfHeight = WallHeight * 100.0f * 0.5f;
+	const float HalfThickness = WallThickness * 100.0f * 0.5f;
+
+	OutCorners[0] = FVector(-HalfWidth, -HalfThickness, -HalfHeight); // InnerBL
+	OutCorners[1] = FVector(HalfWidth, -HalfThickness, -HalfHeight);  // InnerBR
+	OutCorners[2] = FVector(HalfWidth, -HalfThickness, HalfHeight);   // InnerTR
+	OutCorners[3] = FVector(-HalfWidth, -HalfThickness, HalfHeight);  // InnerTL
+	OutCorners[4] = FVector(-HalfWidth, HalfThickness, -HalfHeight);  // OuterBL
+	OutCorners[5] = FVector(HalfWidth, HalfThickness, -HalfHeight);   // OuterBR
+	OutCorners[6] = FVector(HalfWidth, HalfThickness, HalfHeight);    // OuterTR
+	OutCorners[7] = FVector(-HalfWidth, HalfThickness, HalfHeight);   // OuterTL
+
+	TransformPositions(FTransform(Rotation, Position), OutCorners, OutCorners, 8);
+}
+
+void UWallTransform::LogBenchmark(int32 NumVertices, int32 Iterations)
+{
+	NumVertices = FMath::Max(NumVertices, 1);
+	Iterations = FMath::Max(Iterations, 1);
+
+	// Wall-local vertices within a 5m wall, unit normals, a typical wall placement
+	FRandomStream Random(1234);
+	TArray<FVector> Positions;
+	TArray<FVector> Normals;
+	Positions.SetNumUninitialized(NumVertices);
+	Normals.SetNumUninitialized(NumVertices);
+	for (int32 i = 0; i < NumVertices; i++)
+	{
+		Positions[i] = FVector(Random.FRandRange(-250.0f, 250.0f), Random.FRandRange(-10.0f, 10.0f), Random.FRandRange(-150.0f, 150.0f));
+		Normals[i] = Random.GetUnitVector();
+	}
+	const FTransform WallTransform(FRotator(0.0f, 90.0f, 0.0f), FVector(1250.0f, -430.0f, 150.0f));
+
+	// Per-vertex loop the wall builders used: FTransform calls appended one at a time
+	TArray<FVector> ScalarPositions;
+	TArray<FVector> ScalarNormals;
+	const double ScalarStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		ScalarPositions.Reset();
+		ScalarNormals.Reset();
+		for (int32 i = 0; i < NumVertices; i++)
+		{
+			ScalarPositions.Add(WallTransform.TransformPosition(Positions[i]));
+		}
+		for (int32 i = 0; i < NumVertices; i++)
+		{
+			ScalarNormals.Add(WallTransform.TransformVectorNoScale(Normals[i]));
+		}
+	}
+	const double ScalarSeconds = (FPlatformTime::Seconds() - ScalarStart) / Iterations;
+
+	TArray<FVector> BatchPositions;
+	TArray<FVector> BatchNormals;
+	const double BatchStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		BatchPositions.Reset();
+		BatchNormals.Reset();
+		AppendTransformed(WallTransform, Positions, Normals, BatchPositions, BatchNormals);
+	}
+	const double BatchSeconds = (FPlatformTime::Seconds() - BatchStart) / Iterations;
+
+	// Both paths must agree (quaternion vs matrix rounding only)
+	double MaxError = 0.0;
+	for (int32 i = 0; i < NumVertices; i++)
+	{
+		MaxError = FMath::Max(MaxError, FVector::Dist(ScalarPositions[i], BatchPositions[i]));
+		MaxError = FMath::Max(MaxError, FVector::Dist(ScalarNormals[i], BatchNormals[i]));
+	}
+
+	UE_LOG(LogBackRoomGenerator, Log, TEXT("Wall transform benchmark: %d vertices x %d runs - per-vertex %.3f ms, batch %.3f ms (%.2fx), max difference %.6f cm"),
+		NumVertices, Iterations, ScalarSeconds * 1000.0, BatchSeconds * 1000.0,
+		BatchSeconds > 0.0 ? ScalarSeconds / BatchSeconds : 0.0, MaxError);
+}
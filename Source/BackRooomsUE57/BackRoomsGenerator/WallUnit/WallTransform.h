@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Batch vertex transforms shared by all wall builders
+ * The transform is turned into matrix rows once, then every vertex is a few vector multiply-adds
+ * written straight into pre-sized output (no per-vertex quaternion math, no per-vertex Add).
+ */
+class UWallTransform
+{
+public:
+	// Out[i] = Transform.TransformPosition(In[i]) - In and Out may be the same buffer
+	static void TransformPositions(const FTransform& Transform, const FVector* InPositions, FVector* OutPositions, int32 Count);
+
+	// Out[i] = Transform.TransformVectorNoScale(In[i]) - In and Out may be the same buffer
+	static void TransformNormals(const FTransform& Transform, const FVector* InNormals, FVector* OutNormals, int32 Count);
+
+	// Grow both outputs once and write the transformed positions and normals to their ends
+	static void AppendTransformed(const FTransform& Transform, const TArray<FVector>& Positions, const TArray<FVector>& Normals,
+		TArray<FVector>& OutPositions, TArray<FVector>& OutNormals);
+
+	// The 8 corners of a wall box (Inner/Outer BL, BR, TR, TL; sizes in meters) placed in world space
+	// Local frame: centered at the origin, X = width, Y = thickness (inner side -Y), Z = height
+	static void PlaceWallCorners(const FVector& Position, const FRotator& Rotation,
+		float WallWidth, float WallHeight, float WallThickness, FVector OutCorners[8]);
+
+	// Time the per-vertex FTransform loop against the batch kernel on random wall-sized vertices and log the result
+	static void LogBenchmark(int32 NumVertices, int32 Iterations);
+};
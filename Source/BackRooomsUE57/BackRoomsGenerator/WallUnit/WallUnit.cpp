@@ -1,14 +1,17 @@
 #include "WallUnit.h"
+#include "WallTransform.h"
+#include "WallMaterialCache.h"
 #include "../Main.h"  // For log category
 #include "Engine/World.h"
 #include "ProceduralMeshComponent.h"
-#include "Materials/MaterialInstanceDynamic.h"
+#include "HAL/PlatformTime.h"
 
 /**
  * UNIFIED WALL UNIT - SINGLE SYSTEM
  * 
  * This file now serves as a clean interface that uses the irregular hole system for all hole types:
  * - WallGeneratorCommon: Shared utilities (FFaceData, AddQuadFace, GenerateThickWallSegment)
+ * - HoleDescriptor: Compiles FWallHoleConfig/FDoorConfig into FResolvedHole before any geometry is built
  * - HoleGenerator: Universal hole generation system that handles:
  *   * Rectangle holes: 4 points, 45° rotation, 0 irregularity
  *   * Circle holes: 24 points, 0° rotation, 0 irregularity  
@@ -22,6 +25,13 @@
  * - Proven geometry for all shapes
  */
 
+namespace
+{
+	// Game-thread timing of section upload + collision creation (cooking happens inside these calls)
+	int32 GCollisionSetupUploads = 0;
+	double GCollisionSetupSeconds = 0.0;
+}
+
 void UWallUnit::GenerateThickWall(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
 	FVector InnerBL, FVector InnerBR, FVector InnerTR, FVector InnerTL,
 	FVector OuterBL, FVector OuterBR, FVector OuterTR, FVector OuterTL,
@@ -45,46 +55,23 @@ void UWallUnit::GenerateThickWallWithDoor(TArray<FVector>& Vertices, TArray<int3
 	FVector OuterBL, FVector OuterBR, FVector OuterTR, FVector OuterTL,
 	float WallWidth, float WallHeight, const FDoorConfig& Door, float WallThickness)
 {
-	// Delegate to appropriate specialized generator based on hole shape
-	switch (Door.HoleShape)
+	// Resolve the door once (circles become 24-point polygons), then delegate by shape
+	const FResolvedHole Hole = FResolvedHole::Compile(Door, WallWidth, WallHeight);
+	
+	if (Hole.IsPolygon())
 	{
-		case EHoleShape::Circle:
-		{
-			// Convert circular holes to irregular circle holes for consistency
-			FDoorConfig CircleConfig = Door;
-			CircleConfig.HoleShape = EHoleShape::Irregular;
-			CircleConfig.IrregularSize = Door.Radius * 2.0f; // Diameter
-			CircleConfig.Irregularity = 0.0f;          // No randomness for perfect geometric shape
-			CircleConfig.IrregularPoints = 24;         // 24 points create smooth circle
-			CircleConfig.IrregularSmoothness = 1.0f;   // Maximum smoothness for clean edges
-			CircleConfig.IrregularRotation = 0.0f;     // No rotation needed for circles
-			
-			UHoleGenerator::GenerateWallWithHole(Vertices, Triangles, Normals, UVs,
-				InnerBL, InnerBR, InnerTR, InnerTL,
-				OuterBL, OuterBR, OuterTR, OuterTL,
-				WallWidth, WallHeight, CircleConfig, WallThickness);
-			break;
-		}
-		
-		case EHoleShape::Irregular:
-		{
-			UHoleGenerator::GenerateWallWithHole(Vertices, Triangles, Normals, UVs,
-				InnerBL, InnerBR, InnerTR, InnerTL,
-				OuterBL, OuterBR, OuterTR, OuterTL,
-				WallWidth, WallHeight, Door, WallThickness);
-			break;
-		}
-		
-		case EHoleShape::Rectangle:
-		default:
-		{
-			// Use fast simple rectangle hole generation for performance
-			GenerateSimpleRectangleHole(Vertices, Triangles, Normals, UVs,
-				InnerBL, InnerBR, InnerTR, InnerTL,
-				OuterBL, OuterBR, OuterTR, OuterTL,
-				WallWidth, WallHeight, Door, WallThickness);
-			break;
-		}
+		UHoleGenerator::GenerateWallWithHole(Vertices, Triangles, Normals, UVs,
+			InnerBL, InnerBR, InnerTR, InnerTL,
+			OuterBL, OuterBR, OuterTR, OuterTL,
+			WallWidth, WallHeight, Hole, WallThickness);
+	}
+	else
+	{
+		// Use fast simple rectangle hole generation for performance
+		GenerateSimpleRectangleHole(Vertices, Triangles, Normals, UVs,
+			InnerBL, InnerBR, InnerTR, InnerTL,
+			OuterBL, OuterBR, OuterTR, OuterTL,
+			WallWidth, WallHeight, Hole, WallThickness);
 	}
 }
 
@@ -186,23 +173,17 @@ void UWallUnit::GenerateThickWallWithMultipleDoors(TArray<FVector>& Vertices, TA
 void UWallUnit::GenerateSimpleRectangleHole(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
 	FVector InnerBL, FVector InnerBR, FVector InnerTR, FVector InnerTL,
 	FVector OuterBL, FVector OuterBR, FVector OuterTR, FVector OuterTL,
-	float WallWidth, float WallHeight, const FDoorConfig& Door, float WallThickness)
+	float WallWidth, float WallHeight, const FResolvedHole& Hole, float WallThickness)
 {
 	// Convert to unreal units
 	float WallWidthCm = MetersToUnrealUnits(WallWidth);
 	float WallHeightCm = MetersToUnrealUnits(WallHeight);
-	float HoleWidthCm = MetersToUnrealUnits(Door.Width);
-	float HoleHeightCm = MetersToUnrealUnits(Door.Height);
-	float OffsetFromCenterCm = MetersToUnrealUnits(Door.OffsetFromCenter);
-	
-	// Calculate hole position
-	float HoleCenterX = (WallWidthCm * 0.5f) + OffsetFromCenterCm;
 	
-	// Hole bounds - CRITICAL: Bottom starts at ground level (Z=0)
-	float HoleLeft = HoleCenterX - (HoleWidthCm * 0.5f);
-	float HoleRight = HoleCenterX + (HoleWidthCm * 0.5f);
-	float HoleBottom = 0.0f;  // Start at ground level (floor height)
-	float HoleTop = HoleHeightCm;  // Extend upward from ground
+	// Hole bounds from the resolved center (door configs resolve to a ground-level bottom)
+	float HoleLeft = Hole.CenterXCm - (Hole.WidthCm * 0.5f);
+	float HoleRight = Hole.CenterXCm + (Hole.WidthCm * 0.5f);
+	float HoleBottom = Hole.CenterZCm - (Hole.HeightCm * 0.5f);
+	float HoleTop = Hole.CenterZCm + (Hole.HeightCm * 0.5f);
 	
 	// Clamp to wall bounds
 	HoleLeft = FMath::Max(0.0f, HoleLeft);
@@ -221,165 +202,13 @@ void UWallUnit::GenerateSimpleRectangleHole(TArray<FVector>& Vertices, TArray<in
 		return;
 	}
 	
-	// Generate wall segments around the hole - simple 4-segment approach
-	FVector WallWidthDirection = (InnerBR - InnerBL).GetSafeNormal();
-	FVector WallHeightDirection = (InnerTL - InnerBL).GetSafeNormal();
-	FVector OuterWidthDirection = (OuterBR - OuterBL).GetSafeNormal();
-	FVector OuterHeightDirection = (OuterTL - OuterBL).GetSafeNormal();
-	
-	// Bottom segment (0 to HoleBottom)
-	if (HoleBottom > 1.0f)
-	{
-		FVector SegInnerBL = InnerBL;
-		FVector SegInnerBR = InnerBR;
-		FVector SegInnerTR = InnerBL + (WallWidthDirection * WallWidthCm) + (WallHeightDirection * HoleBottom);
-		FVector SegInnerTL = InnerBL + (WallHeightDirection * HoleBottom);
-		
-		FVector SegOuterBL = OuterBL;
-		FVector SegOuterBR = OuterBR;
-		FVector SegOuterTR = OuterBL + (OuterWidthDirection * WallWidthCm) + (OuterHeightDirection * HoleBottom);
-		FVector SegOuterTL = OuterBL + (OuterHeightDirection * HoleBottom);
-		
-		UWallCommon::GenerateThickWallSegment(Vertices, Triangles, Normals, UVs,
-			SegInnerBL, SegInnerBR, SegInnerTR, SegInnerTL,
-			SegOuterBL, SegOuterBR, SegOuterTR, SegOuterTL,
-			WallWidth, HoleBottom / 100.0f, WallThickness);
-	}
-	
-	// Top segment (HoleTop to WallHeight)
-	if ((WallHeightCm - HoleTop) > 1.0f)
-	{
-		FVector SegInnerBL = InnerBL + (WallHeightDirection * HoleTop);
-		FVector SegInnerBR = InnerBL + (WallWidthDirection * WallWidthCm) + (WallHeightDirection * HoleTop);
-		FVector SegInnerTR = InnerTR;
-		FVector SegInnerTL = InnerTL;
-		
-		FVector SegOuterBL = OuterBL + (OuterHeightDirection * HoleTop);
-		FVector SegOuterBR = OuterBL + (OuterWidthDirection * WallWidthCm) + (OuterHeightDirection * HoleTop);
-		FVector SegOuterTR = OuterTR;
-		FVector SegOuterTL = OuterTL;
-		
-		UWallCommon::GenerateThickWallSegment(Vertices, Triangles, Normals, UVs,
-			SegInnerBL, SegInnerBR, SegInnerTR, SegInnerTL,
-			SegOuterBL, SegOuterBR, SegOuterTR, SegOuterTL,
-			WallWidth, (WallHeightCm - HoleTop) / 100.0f, WallThickness);
-	}
-	
-	// Left segment (0 to HoleLeft, within hole height)
-	if (HoleLeft > 1.0f)
-	{
-		FVector SegInnerBL = InnerBL + (WallHeightDirection * HoleBottom);
-		FVector SegInnerBR = InnerBL + (WallWidthDirection * HoleLeft) + (WallHeightDirection * HoleBottom);
-		FVector SegInnerTR = InnerBL + (WallWidthDirection * HoleLeft) + (WallHeightDirection * HoleTop);
-		FVector SegInnerTL = InnerBL + (WallHeightDirection * HoleTop);
-		
-		FVector SegOuterBL = OuterBL + (OuterHeightDirection * HoleBottom);
-		FVector SegOuterBR = OuterBL + (OuterWidthDirection * HoleLeft) + (OuterHeightDirection * HoleBottom);
-		FVector SegOuterTR = OuterBL + (OuterWidthDirection * HoleLeft) + (OuterHeightDirection * HoleTop);
-		FVector SegOuterTL = OuterBL + (OuterHeightDirection * HoleTop);
-		
-		UWallCommon::GenerateThickWallSegment(Vertices, Triangles, Normals, UVs,
-			SegInnerBL, SegInnerBR, SegInnerTR, SegInnerTL,
-			SegOuterBL, SegOuterBR, SegOuterTR, SegOuterTL,
-			HoleLeft / 100.0f, (HoleTop - HoleBottom) / 100.0f, WallThickness);
-	}
-	
-	// Right segment (HoleRight to WallWidth, within hole height)
-	if ((WallWidthCm - HoleRight) > 1.0f)
-	{
-		FVector SegInnerBL = InnerBL + (WallWidthDirection * HoleRight) + (WallHeightDirection * HoleBottom);
-		FVector SegInnerBR = InnerBL + (WallWidthDirection * WallWidthCm) + (WallHeightDirection * HoleBottom);
-		FVector SegInnerTR = InnerBL + (WallWidthDirection * WallWidthCm) + (WallHeightDirection * HoleTop);
-		FVector SegInnerTL = InnerBL + (WallWidthDirection * HoleRight) + (WallHeightDirection * HoleTop);
-		
-		FVector SegOuterBL = OuterBL + (OuterWidthDirection * HoleRight) + (OuterHeightDirection * HoleBottom);
-		FVector SegOuterBR = OuterBL + (OuterWidthDirection * WallWidthCm) + (OuterHeightDirection * HoleBottom);
-		FVector SegOuterTR = OuterBL + (OuterWidthDirection * WallWidthCm) + (OuterHeightDirection * HoleTop);
-		FVector SegOuterTL = OuterBL + (OuterWidthDirection * HoleRight) + (OuterHeightDirection * HoleTop);
-		
-		UWallCommon::GenerateThickWallSegment(Vertices, Triangles, Normals, UVs,
-			SegInnerBL, SegInnerBR, SegInnerTR, SegInnerTL,
-			SegOuterBL, SegOuterBR, SegOuterTR, SegOuterTL,
-			(WallWidthCm - HoleRight) / 100.0f, (HoleTop - HoleBottom) / 100.0f, WallThickness);
-	}
-	
-	// Generate hole interior faces (the thickness edges of the hole)
-	GenerateHoleInteriorFaces(Vertices, Triangles, Normals, UVs,
-		InnerBL, WallWidthDirection, WallHeightDirection,
-		OuterBL, OuterWidthDirection, OuterHeightDirection,
+	// One closed frame around the hole: wall faces, outer edges and hole rim, no overlapping segments
+	UWallCommon::GenerateThickWallFrame(Vertices, Triangles, Normals, UVs,
+		InnerBL, InnerBR, InnerTR, InnerTL,
+		OuterBL, OuterBR, OuterTR, OuterTL,
 		HoleLeft, HoleRight, HoleBottom, HoleTop, WallThickness);
 }
 
-void UWallUnit::GenerateHoleInteriorFaces(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
-	FVector InnerBL, FVector WallWidthDirection, FVector WallHeightDirection,
-	FVector OuterBL, FVector OuterWidthDirection, FVector OuterHeightDirection,
-	float HoleLeft, float HoleRight, float HoleBottom, float HoleTop, float WallThickness)
-{
-	// Generate the 4 interior faces that show the wall thickness around the hole opening
-	
-	// Helper function to add a quad face
-	auto AddQuadFace = [&](FVector V0, FVector V1, FVector V2, FVector V3, FVector Normal)
-	{
-		int32 StartIndex = Vertices.Num();
-		
-		// Add vertices
-		Vertices.Add(V0);
-		Vertices.Add(V1);
-		Vertices.Add(V2);
-		Vertices.Add(V3);
-		
-		// Add normals
-		Normals.Add(Normal);
-		Normals.Add(Normal);
-		Normals.Add(Normal);
-		Normals.Add(Normal);
-		
-		// Add UVs (simple planar mapping)
-		UVs.Add(FVector2D(0.0f, 0.0f));
-		UVs.Add(FVector2D(1.0f, 0.0f));
-		UVs.Add(FVector2D(1.0f, 1.0f));
-		UVs.Add(FVector2D(0.0f, 1.0f));
-		
-		// Add triangles (two triangles per quad)
-		Triangles.Add(StartIndex + 0);
-		Triangles.Add(StartIndex + 1);
-		Triangles.Add(StartIndex + 2);
-		
-		Triangles.Add(StartIndex + 0);
-		Triangles.Add(StartIndex + 2);
-		Triangles.Add(StartIndex + 3);
-	};
-	
-	// Calculate hole corner positions on inner and outer surfaces
-	FVector InnerBottomLeft = InnerBL + (WallWidthDirection * HoleLeft) + (WallHeightDirection * HoleBottom);
-	FVector InnerBottomRight = InnerBL + (WallWidthDirection * HoleRight) + (WallHeightDirection * HoleBottom);
-	FVector InnerTopLeft = InnerBL + (WallWidthDirection * HoleLeft) + (WallHeightDirection * HoleTop);
-	FVector InnerTopRight = InnerBL + (WallWidthDirection * HoleRight) + (WallHeightDirection * HoleTop);
-	
-	FVector OuterBottomLeft = OuterBL + (OuterWidthDirection * HoleLeft) + (OuterHeightDirection * HoleBottom);
-	FVector OuterBottomRight = OuterBL + (OuterWidthDirection * HoleRight) + (OuterHeightDirection * HoleBottom);
-	FVector OuterTopLeft = OuterBL + (OuterWidthDirection * HoleLeft) + (OuterHeightDirection * HoleTop);
-	FVector OuterTopRight = OuterBL + (OuterWidthDirection * HoleRight) + (OuterHeightDirection * HoleTop);
-	
-	// Calculate face normals
-	FVector LeftNormal = -WallWidthDirection;  // Points left (into hole)
-	FVector RightNormal = WallWidthDirection;  // Points right (into hole)
-	FVector BottomNormal = -WallHeightDirection; // Points down (into hole)
-	FVector TopNormal = WallHeightDirection;   // Points up (into hole)
-	
-	// Left interior face (connects left edge from inner to outer surface)
-	AddQuadFace(InnerBottomLeft, OuterBottomLeft, OuterTopLeft, InnerTopLeft, LeftNormal);
-	
-	// Right interior face (connects right edge from inner to outer surface)
-	AddQuadFace(OuterBottomRight, InnerBottomRight, InnerTopRight, OuterTopRight, RightNormal);
-	
-	// Bottom interior face (connects bottom edge from inner to outer surface)
-	AddQuadFace(OuterBottomLeft, InnerBottomLeft, InnerBottomRight, OuterBottomRight, BottomNormal);
-	
-	// Top interior face (connects top edge from inner to outer surface)
-	AddQuadFace(InnerTopLeft, OuterTopLeft, OuterTopRight, InnerTopRight, TopNormal);
-}
-
 void UWallUnit::DrawWallCenterDebugSphere(UWorld* World, 
 	FVector InnerBL, FVector InnerBR, FVector InnerTR, FVector InnerTL,
 	FVector OuterBL, FVector OuterBR, FVector OuterTR, FVector OuterTL)
@@ -449,42 +278,17 @@ void UWallUnit::GenerateCompleteWallWithDoorway(TArray<FVector>& Vertices, TArra
 	float WallWidth, float WallHeight, float WallThickness, UWorld* World,
 	float DoorWidth, float DoorHeight, float HorizontalPosition, float VerticalPosition)
 {
-	// Convert meters to Unreal units (cm)
-	float WidthCm = WallWidth * 100.0f;
-	float HeightCm = WallHeight * 100.0f;
-	float ThicknessCm = WallThickness * 100.0f;
-	
-	// Define wall corners centered around origin (for proper rotation)
-	FVector InnerBL = FVector(-WidthCm * 0.5f, -ThicknessCm * 0.5f, -HeightCm * 0.5f);
-	FVector InnerBR = FVector(WidthCm * 0.5f, -ThicknessCm * 0.5f, -HeightCm * 0.5f);
-	FVector InnerTR = FVector(WidthCm * 0.5f, -ThicknessCm * 0.5f, HeightCm * 0.5f);
-	FVector InnerTL = FVector(-WidthCm * 0.5f, -ThicknessCm * 0.5f, HeightCm * 0.5f);
-	
-	FVector OuterBL = FVector(-WidthCm * 0.5f, ThicknessCm * 0.5f, -HeightCm * 0.5f);
-	FVector OuterBR = FVector(WidthCm * 0.5f, ThicknessCm * 0.5f, -HeightCm * 0.5f);
-	FVector OuterTR = FVector(WidthCm * 0.5f, ThicknessCm * 0.5f, HeightCm * 0.5f);
-	FVector OuterTL = FVector(-WidthCm * 0.5f, ThicknessCm * 0.5f, HeightCm * 0.5f);
-	
-	// Apply rotation around the wall's center (origin)
-	FTransform RotationTransform(Rotation);
-	InnerBL = RotationTransform.TransformPosition(InnerBL);
-	InnerBR = RotationTransform.TransformPosition(InnerBR);
-	InnerTR = RotationTransform.TransformPosition(InnerTR);
-	InnerTL = RotationTransform.TransformPosition(InnerTL);
-	OuterBL = RotationTransform.TransformPosition(OuterBL);
-	OuterBR = RotationTransform.TransformPosition(OuterBR);
-	OuterTR = RotationTransform.TransformPosition(OuterTR);
-	OuterTL = RotationTransform.TransformPosition(OuterTL);
-	
-	// Apply position offset after rotation
-	InnerBL += Position;
-	InnerBR += Position;
-	InnerTR += Position;
-	InnerTL += Position;
-	OuterBL += Position;
-	OuterBR += Position;
-	OuterTR += Position;
-	OuterTL += Position;
+	// Wall corners centered around origin, rotated around the wall's center and moved to Position in one batch
+	FVector Corners[8];
+	UWallTransform::PlaceWallCorners(Position, Rotation, WallWidth, WallHeight, WallThickness, Corners);
+	const FVector& InnerBL = Corners[0];
+	const FVector& InnerBR = Corners[1];
+	const FVector& InnerTR = Corners[2];
+	const FVector& InnerTL = Corners[3];
+	const FVector& OuterBL = Corners[4];
+	const FVector& OuterBR = Corners[5];
+	const FVector& OuterTR = Corners[6];
+	const FVector& OuterTL = Corners[7];
 	
 	// Generate the wall with doorway using the clean interface
 	GenerateDoorway(Vertices, Triangles, Normals, UVs,
@@ -509,31 +313,6 @@ void UWallUnit::CreateWallMeshWithDoorway(TArray<FVector>& OutVertices, TArray<i
 	GenerateCompleteWallWithDoorway(OutVertices, OutTriangles, OutNormals, OutUVs,
 		Position, Rotation, WallWidth, WallHeight, WallThickness, World,
 		DoorWidth, DoorHeight, HorizontalPosition, VerticalPosition);
-	
-	// Make it double-sided by creating copies and then appending them
-	TArray<int32> OriginalTriangles = OutTriangles;
-	TArray<FVector> OriginalNormals = OutNormals;
-	TArray<FVector2D> OriginalUVs = OutUVs;
-	
-	// Add reversed triangles (swap order for opposite normal direction)
-	for (int32 i = 0; i < OriginalTriangles.Num(); i += 3)
-	{
-		OutTriangles.Add(OriginalTriangles[i + 2]);
-		OutTriangles.Add(OriginalTriangles[i + 1]);
-		OutTriangles.Add(OriginalTriangles[i + 0]);
-	}
-	
-	// Add reversed normals for the reversed faces
-	for (int32 i = 0; i < OriginalNormals.Num(); i++)
-	{
-		OutNormals.Add(-OriginalNormals[i]);
-	}
-	
-	// Add duplicate UVs for the reversed faces
-	for (int32 i = 0; i < OriginalUVs.Num(); i++)
-	{
-		OutUVs.Add(OriginalUVs[i]);
-	}
 }
 
 AActor* UWallUnit::CreateCompleteWallActor(UWorld* World, const FVector& Position, const FRotator& Rotation,
@@ -561,36 +340,15 @@ AActor* UWallUnit::CreateCompleteWallActor(UWorld* World, const FVector& Positio
 	// UE_LOG(LogBackRoomGenerator, Warning, TEXT("🔧 CreateWallMeshWithDoorway: Generated %d vertices, %d triangles"), 
 	//	WallVertices.Num(), WallTriangles.Num());
 	
-	// Create actor and mesh component
-	AActor* WallActor = World->SpawnActor<AActor>();
-	UProceduralMeshComponent* WallMesh = NewObject<UProceduralMeshComponent>(WallActor);
-	WallActor->SetRootComponent(WallMesh);
-	
-	// Setup collision settings - standard wall configuration
-	WallMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-	WallMesh->SetCollisionObjectType(ECollisionChannel::ECC_WorldStatic);
-	WallMesh->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Block);
-	WallMesh->bUseComplexAsSimpleCollision = true;
-	WallMesh->RegisterComponent();
-	
-	// Create mesh section
-	WallMesh->CreateMeshSection(0, WallVertices, WallTriangles, WallNormals, WallUVs, 
-		TArray<FColor>(), TArray<FProcMeshTangent>(), true);
+	// Collision boxes around the same doorway (bottom-aligned doors are centered half their height up, as in GenerateDoorway)
+	const float HoleCenterY = (VerticalPosition == 0.0f) ? (DoorHeight * 0.5f) / WallHeight : VerticalPosition;
+	const FResolvedHole Hole = FResolvedHole::MakeRectangle(WallWidth, WallHeight, DoorWidth, DoorHeight, HorizontalPosition, HoleCenterY);
+	FWallGeometry CollisionGeometry;
+	GenerateCollisionBoxes(WallWidth, WallHeight, WallThickness, &Hole, CollisionGeometry.CollisionBoxes);
+	TArray<TArray<FVector>> CollisionHulls;
+	UWallGeometryCache::TransformCollision(CollisionGeometry, Position, Rotation, CollisionHulls);
 	
-	// Apply colored material
-	UMaterialInterface* BaseMaterial = LoadObject<UMaterialInterface>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial"));
-	if (BaseMaterial)
-	{
-		UMaterialInstanceDynamic* DynMat = UMaterialInstanceDynamic::Create(BaseMaterial, WallActor);
-		if (DynMat)
-		{
-			DynMat->SetVectorParameterValue(TEXT("Color"), Color);
-			DynMat->SetVectorParameterValue(TEXT("BaseColor"), Color);
-			WallMesh->SetMaterial(0, DynMat);
-		}
-	}
-	
-	return WallActor;
+	return CreateWallActorFromMesh(World, WallVertices, WallTriangles, WallNormals, WallUVs, Color, &CollisionHulls);
 }
 
 AActor* UWallUnit::CreateSolidWallActor(UWorld* World, const FVector& Position, const FRotator& Rotation,
@@ -601,79 +359,36 @@ AActor* UWallUnit::CreateSolidWallActor(UWorld* World, const FVector& Position,
 		return nullptr;
 	}
 
-	// Convert meters to Unreal units (cm)
-	float WidthCm = WallWidth * 100.0f;
-	float HeightCm = WallHeight * 100.0f;
-	float ThicknessCm = WallThickness * 100.0f;
-	
-	// Define wall corners centered around origin (for proper rotation)
-	FVector InnerBL = FVector(-WidthCm * 0.5f, -ThicknessCm * 0.5f, -HeightCm * 0.5f);
-	FVector InnerBR = FVector(WidthCm * 0.5f, -ThicknessCm * 0.5f, -HeightCm * 0.5f);
-	FVector InnerTR = FVector(WidthCm * 0.5f, -ThicknessCm * 0.5f, HeightCm * 0.5f);
-	FVector InnerTL = FVector(-WidthCm * 0.5f, -ThicknessCm * 0.5f, HeightCm * 0.5f);
-	
-	FVector OuterBL = FVector(-WidthCm * 0.5f, ThicknessCm * 0.5f, -HeightCm * 0.5f);
-	FVector OuterBR = FVector(WidthCm * 0.5f, ThicknessCm * 0.5f, -HeightCm * 0.5f);
-	FVector OuterTR = FVector(WidthCm * 0.5f, ThicknessCm * 0.5f, HeightCm * 0.5f);
-	FVector OuterTL = FVector(-WidthCm * 0.5f, ThicknessCm * 0.5f, HeightCm * 0.5f);
-	
-	// Apply rotation around the wall's center (origin)
-	FTransform RotationTransform(Rotation);
-	InnerBL = RotationTransform.TransformPosition(InnerBL);
-	InnerBR = RotationTransform.TransformPosition(InnerBR);
-	InnerTR = RotationTransform.TransformPosition(InnerTR);
-	InnerTL = RotationTransform.TransformPosition(InnerTL);
-	OuterBL = RotationTransform.TransformPosition(OuterBL);
-	OuterBR = RotationTransform.TransformPosition(OuterBR);
-	OuterTR = RotationTransform.TransformPosition(OuterTR);
-	OuterTL = RotationTransform.TransformPosition(OuterTL);
-	
-	// Apply position offset after rotation
-	InnerBL += Position;
-	InnerBR += Position;
-	InnerTR += Position;
-	InnerTL += Position;
-	OuterBL += Position;
-	OuterBR += Position;
-	OuterTR += Position;
-	OuterTL += Position;
-	
 	// Generate solid wall mesh (no holes)
 	TArray<FVector> WallVertices;
 	TArray<int32> WallTriangles;
 	TArray<FVector> WallNormals;
 	TArray<FVector2D> WallUVs;
 	
-	GenerateThickWall(WallVertices, WallTriangles, WallNormals, WallUVs,
-		InnerBL, InnerBR, InnerTR, InnerTL,
-		OuterBL, OuterBR, OuterTR, OuterTL,
-		WallWidth, WallHeight, EWallSide::North, WallThickness, World);
-	
-	// Make it double-sided by creating copies and then appending them
-	TArray<int32> OriginalTriangles = WallTriangles;
-	TArray<FVector> OriginalNormals = WallNormals;
-	TArray<FVector2D> OriginalUVs = WallUVs;
-	
-	// Add reversed triangles (swap order for opposite normal direction)
-	for (int32 i = 0; i < OriginalTriangles.Num(); i += 3)
-	{
-		WallTriangles.Add(OriginalTriangles[i + 2]);
-		WallTriangles.Add(OriginalTriangles[i + 1]);
-		WallTriangles.Add(OriginalTriangles[i + 0]);
-	}
+	TArray<TArray<FVector>> CollisionHulls;
 	
-	// Add reversed normals for the reversed faces
-	for (int32 i = 0; i < OriginalNormals.Num(); i++)
-	{
-		WallNormals.Add(-OriginalNormals[i]);
-	}
+	GenerateCachedWallMesh(WallVertices, WallTriangles, WallNormals, WallUVs,
+		Position, Rotation, WallWidth, WallHeight, WallThickness, nullptr, World, &CollisionHulls);
 	
-	// Add duplicate UVs for the reversed faces
-	for (int32 i = 0; i < OriginalUVs.Num(); i++)
+	return CreateWallActorFromMesh(World, WallVertices, WallTriangles, WallNormals, WallUVs, Color, &CollisionHulls);
+}
+
+AActor* UWallUnit::CreateWallActorFromMesh(UWorld* World, const TArray<FVector>& WallVertices, const TArray<int32>& WallTriangles,
+	const TArray<FVector>& WallNormals, const TArray<FVector2D>& WallUVs, const FLinearColor& Color,
+	const TArray<TArray<FVector>>* CollisionHulls, bool bAsyncCooking)
+{
+	AActor* WallActor = SpawnWallActor(World, bAsyncCooking);
+	SetWallActorMesh(WallActor, WallVertices, WallTriangles, WallNormals, WallUVs, Color, CollisionHulls);
+	return WallActor;
+}
+
+AActor* UWallUnit::SpawnWallActor(UWorld* World, bool bAsyncCooking)
+{
+	if (!World)
 	{
-		WallUVs.Add(OriginalUVs[i]);
+		return nullptr;
 	}
-	
+
 	// Create actor and mesh component
 	AActor* WallActor = World->SpawnActor<AActor>();
 	UProceduralMeshComponent* WallMesh = NewObject<UProceduralMeshComponent>(WallActor);
@@ -684,169 +399,86 @@ AActor* UWallUnit::CreateSolidWallActor(UWorld* World, const FVector& Position,
 	WallMesh->SetCollisionObjectType(ECollisionChannel::ECC_WorldStatic);
 	WallMesh->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Block);
 	WallMesh->bUseComplexAsSimpleCollision = true;
+	WallMesh->bUseAsyncCooking = bAsyncCooking;
 	WallMesh->RegisterComponent();
 	
-	// Create mesh section
-	WallMesh->CreateMeshSection(0, WallVertices, WallTriangles, WallNormals, WallUVs, 
-		TArray<FColor>(), TArray<FProcMeshTangent>(), true);
-	
-	// Apply colored material
-	UMaterialInterface* BaseMaterial = LoadObject<UMaterialInterface>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial"));
-	if (BaseMaterial)
-	{
-		UMaterialInstanceDynamic* DynMat = UMaterialInstanceDynamic::Create(BaseMaterial, WallActor);
-		if (DynMat)
-		{
-			DynMat->SetVectorParameterValue(TEXT("Color"), Color);
-			DynMat->SetVectorParameterValue(TEXT("BaseColor"), Color);
-			WallMesh->SetMaterial(0, DynMat);
-		}
-	}
-	
 	return WallActor;
 }
 
-void UWallUnit::GenerateWallWithCustomSquareHole(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
-	FVector InnerBL, FVector InnerBR, FVector InnerTR, FVector InnerTL,
-	FVector OuterBL, FVector OuterBR, FVector OuterTR, FVector OuterTL,
-	float WallWidth, float WallHeight, float WallThickness, UWorld* World,
-	float HoleWidth, float HoleHeight, float HoleCenterX, float HoleCenterY)
+bool UWallUnit::SetWallActorMesh(AActor* WallActor, const TArray<FVector>& WallVertices, const TArray<int32>& WallTriangles,
+	const TArray<FVector>& WallNormals, const TArray<FVector2D>& WallUVs, const FLinearColor& Color,
+	const TArray<TArray<FVector>>* CollisionHulls)
 {
-	// FIXED: Generate wall with proper vertical positioning
-	// HoleCenterX: 0.0 = left edge, 0.5 = center, 1.0 = right edge
-	// HoleCenterY: 0.0 = bottom edge, 0.5 = center, 1.0 = top edge
-	
-	// Convert to unreal units
-	float WallWidthCm = MetersToUnrealUnits(WallWidth);
-	float WallHeightCm = MetersToUnrealUnits(WallHeight);
-	float HoleWidthCm = MetersToUnrealUnits(HoleWidth);
-	float HoleHeightCm = MetersToUnrealUnits(HoleHeight);
-	
-	// Calculate hole position from CENTER coordinates
-	// Wall coordinate system: InnerBL starts at (-WallWidth/2, -WallHeight/2)
-	// Hole positioning: 0.0 = left edge, 0.5 = center, 1.0 = right edge
-	// Convert normalized position to distance from left edge (InnerBL)
-	
-	float HoleCenterXCm = HoleCenterX * WallWidthCm;  // Distance from left edge
-	float HoleCenterYCm = HoleCenterY * WallHeightCm; // Distance from bottom edge
-	
-	// Calculate hole bounds relative to wall's left edge (for segment generation)
-	float HoleLeft = HoleCenterXCm - (HoleWidthCm * 0.5f);
-	float HoleRight = HoleCenterXCm + (HoleWidthCm * 0.5f);
-	float HoleBottom = HoleCenterYCm - (HoleHeightCm * 0.5f);
-	float HoleTop = HoleCenterYCm + (HoleHeightCm * 0.5f);
-	
-	// DEBUG: Log hole positioning calculation
-	if (World)
+	UProceduralMeshComponent* WallMesh = WallActor ? Cast<UProceduralMeshComponent>(WallActor->GetRootComponent()) : nullptr;
+	if (!WallMesh)
 	{
-		// UE_LOG(LogBackRoomGenerator, Warning, TEXT("HOLE DEBUG: HoleCenterX=%.2f->%.1fcm, HoleLeft=%.1fcm, HoleRight=%.1fcm"), 
-		//	HoleCenterX, HoleCenterXCm, HoleLeft, HoleRight);
+		UE_LOG(LogBackRoomGenerator, Error, TEXT("SetWallActorMesh: Actor has no procedural mesh root"));
+		return false;
 	}
 	
-	// Clamp to wall bounds
-	HoleLeft = FMath::Max(0.0f, HoleLeft);
-	HoleRight = FMath::Min(WallWidthCm, HoleRight);
-	HoleBottom = FMath::Max(0.0f, HoleBottom);
-	HoleTop = FMath::Min(WallHeightCm, HoleTop);
-	
-	// Skip if hole is too small or outside wall bounds
-	if ((HoleRight - HoleLeft) < 10.0f || (HoleTop - HoleBottom) < 10.0f)
+	const bool bSimpleCollision = CollisionHulls && CollisionHulls->Num() > 0;
+	if (!bSimpleCollision && !WallMesh->bUseComplexAsSimpleCollision)
 	{
-		// Generate solid wall as fallback
-		UWallCommon::GenerateThickWallSegment(Vertices, Triangles, Normals, UVs,
-			InnerBL, InnerBR, InnerTR, InnerTL,
-			OuterBL, OuterBR, OuterTR, OuterTL,
-			WallWidth, WallHeight, WallThickness);
-		return;
+		// Reused actor that had collision boxes - the new trimesh replaces them
+		WallMesh->ClearCollisionConvexMeshes();
 	}
+	WallMesh->bUseComplexAsSimpleCollision = !bSimpleCollision;
 	
-	// Generate wall segments around the hole - simple 4-segment approach
-	FVector WallWidthDirection = (InnerBR - InnerBL).GetSafeNormal();
-	FVector WallHeightDirection = (InnerTL - InnerBL).GetSafeNormal();
-	FVector OuterWidthDirection = (OuterBR - OuterBL).GetSafeNormal();
-	FVector OuterHeightDirection = (OuterTL - OuterBL).GetSafeNormal();
-	
-	// Bottom segment (0 to HoleBottom)
-	if (HoleBottom > 1.0f)
+	// Create (or replace) the mesh section - only cooked as a trimesh when there are no collision boxes
+	const double UploadStart = FPlatformTime::Seconds();
+	WallMesh->CreateMeshSection(0, WallVertices, WallTriangles, WallNormals, WallUVs, 
+		TArray<FColor>(), TArray<FProcMeshTangent>(), !bSimpleCollision);
+	if (bSimpleCollision)
 	{
-		FVector SegInnerBL = InnerBL;
-		FVector SegInnerBR = InnerBR;
-		FVector SegInnerTR = InnerBL + (WallWidthDirection * WallWidthCm) + (WallHeightDirection * HoleBottom);
-		FVector SegInnerTL = InnerBL + (WallHeightDirection * HoleBottom);
-		
-		FVector SegOuterBL = OuterBL;
-		FVector SegOuterBR = OuterBR;
-		FVector SegOuterTR = OuterBL + (OuterWidthDirection * WallWidthCm) + (OuterHeightDirection * HoleBottom);
-		FVector SegOuterTL = OuterBL + (OuterHeightDirection * HoleBottom);
-		
-		UWallCommon::GenerateThickWallSegment(Vertices, Triangles, Normals, UVs,
-			SegInnerBL, SegInnerBR, SegInnerTR, SegInnerTL,
-			SegOuterBL, SegOuterBR, SegOuterTR, SegOuterTL,
-			WallWidth, HoleBottom / 100.0f, WallThickness);
+		// The actor sits at the origin, so world-space hulls are already component-space
+		WallMesh->SetCollisionConvexMeshes(*CollisionHulls);
 	}
+	GCollisionSetupUploads++;
+	GCollisionSetupSeconds += FPlatformTime::Seconds() - UploadStart;
 	
-	// Top segment (HoleTop to WallHeight)
-	if ((WallHeightCm - HoleTop) > 1.0f)
-	{
-		FVector SegInnerBL = InnerBL + (WallHeightDirection * HoleTop);
-		FVector SegInnerBR = InnerBL + (WallWidthDirection * WallWidthCm) + (WallHeightDirection * HoleTop);
-		FVector SegInnerTR = InnerTR;
-		FVector SegInnerTL = InnerTL;
-		
-		FVector SegOuterBL = OuterBL + (OuterHeightDirection * HoleTop);
-		FVector SegOuterBR = OuterBL + (OuterWidthDirection * WallWidthCm) + (OuterHeightDirection * HoleTop);
-		FVector SegOuterTR = OuterTR;
-		FVector SegOuterTL = OuterTL;
-		
-		UWallCommon::GenerateThickWallSegment(Vertices, Triangles, Normals, UVs,
-			SegInnerBL, SegInnerBR, SegInnerTR, SegInnerTL,
-			SegOuterBL, SegOuterBR, SegOuterTR, SegOuterTL,
-			WallWidth, (WallHeightCm - HoleTop) / 100.0f, WallThickness);
-	}
+	// Apply colored material (shared by every wall of this color)
+	WallMesh->SetMaterial(0, UWallMaterialCache::GetColorMaterial(Color));
 	
-	// Left segment (0 to HoleLeft, within hole height)
-	if (HoleLeft > 1.0f)
-	{
-		FVector SegInnerBL = InnerBL + (WallHeightDirection * HoleBottom);
-		FVector SegInnerBR = InnerBL + (WallWidthDirection * HoleLeft) + (WallHeightDirection * HoleBottom);
-		FVector SegInnerTR = InnerBL + (WallWidthDirection * HoleLeft) + (WallHeightDirection * HoleTop);
-		FVector SegInnerTL = InnerBL + (WallHeightDirection * HoleTop);
-		
-		FVector SegOuterBL = OuterBL + (OuterHeightDirection * HoleBottom);
-		FVector SegOuterBR = OuterBL + (OuterWidthDirection * HoleLeft) + (OuterHeightDirection * HoleBottom);
-		FVector SegOuterTR = OuterBL + (OuterWidthDirection * HoleLeft) + (OuterHeightDirection * HoleTop);
-		FVector SegOuterTL = OuterBL + (OuterHeightDirection * HoleTop);
-		
-		UWallCommon::GenerateThickWallSegment(Vertices, Triangles, Normals, UVs,
-			SegInnerBL, SegInnerBR, SegInnerTR, SegInnerTL,
-			SegOuterBL, SegOuterBR, SegOuterTR, SegOuterTL,
-			HoleLeft / 100.0f, (HoleTop - HoleBottom) / 100.0f, WallThickness);
-	}
+	return true;
+}
+
+void UWallUnit::GenerateSolidWallMesh(TArray<FVector>& OutVertices, TArray<int32>& OutTriangles, TArray<FVector>& OutNormals, TArray<FVector2D>& OutUVs,
+	const FVector& Position, const FRotator& Rotation,
+	float WallWidth, float WallHeight, float WallThickness, UWorld* World)
+{
+	// Wall corners centered around origin, rotated around the wall's center and moved to Position in one batch
+	FVector Corners[8];
+	UWallTransform::PlaceWallCorners(Position, Rotation, WallWidth, WallHeight, WallThickness, Corners);
+	const FVector& InnerBL = Corners[0];
+	const FVector& InnerBR = Corners[1];
+	const FVector& InnerTR = Corners[2];
+	const FVector& InnerTL = Corners[3];
+	const FVector& OuterBL = Corners[4];
+	const FVector& OuterBR = Corners[5];
+	const FVector& OuterTR = Corners[6];
+	const FVector& OuterTL = Corners[7];
 	
-	// Right segment (HoleRight to WallWidth, within hole height)
-	if ((WallWidthCm - HoleRight) > 1.0f)
-	{
-		FVector SegInnerBL = InnerBL + (WallWidthDirection * HoleRight) + (WallHeightDirection * HoleBottom);
-		FVector SegInnerBR = InnerBL + (WallWidthDirection * WallWidthCm) + (WallHeightDirection * HoleBottom);
-		FVector SegInnerTR = InnerBL + (WallWidthDirection * WallWidthCm) + (WallHeightDirection * HoleTop);
-		FVector SegInnerTL = InnerBL + (WallWidthDirection * HoleRight) + (WallHeightDirection * HoleTop);
-		
-		FVector SegOuterBL = OuterBL + (OuterWidthDirection * HoleRight) + (OuterHeightDirection * HoleBottom);
-		FVector SegOuterBR = OuterBL + (OuterWidthDirection * WallWidthCm) + (OuterHeightDirection * HoleBottom);
-		FVector SegOuterTR = OuterBL + (OuterWidthDirection * WallWidthCm) + (OuterHeightDirection * HoleTop);
-		FVector SegOuterTL = OuterBL + (OuterWidthDirection * HoleRight) + (OuterHeightDirection * HoleTop);
-		
-		UWallCommon::GenerateThickWallSegment(Vertices, Triangles, Normals, UVs,
-			SegInnerBL, SegInnerBR, SegInnerTR, SegInnerTL,
-			SegOuterBL, SegOuterBR, SegOuterTR, SegOuterTL,
-			(WallWidthCm - HoleRight) / 100.0f, (HoleTop - HoleBottom) / 100.0f, WallThickness);
-	}
+	// Generate solid wall mesh (no holes)
+	GenerateThickWall(OutVertices, OutTriangles, OutNormals, OutUVs,
+		InnerBL, InnerBR, InnerTR, InnerTL,
+		OuterBL, OuterBR, OuterTR, OuterTL,
+		WallWidth, WallHeight, EWallSide::North, WallThickness, World);
+}
+
+void UWallUnit::GenerateWallWithCustomSquareHole(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
+	FVector InnerBL, FVector InnerBR, FVector InnerTR, FVector InnerTL,
+	FVector OuterBL, FVector OuterBR, FVector OuterTR, FVector OuterTL,
+	float WallWidth, float WallHeight, float WallThickness, UWorld* World,
+	float HoleWidth, float HoleHeight, float HoleCenterX, float HoleCenterY)
+{
+	// HoleCenterX: 0.0 = left edge, 0.5 = center, 1.0 = right edge
+	// HoleCenterY: 0.0 = bottom edge, 0.5 = center, 1.0 = top edge
+	const FResolvedHole Hole = FResolvedHole::MakeRectangle(WallWidth, WallHeight, HoleWidth, HoleHeight, HoleCenterX, HoleCenterY);
 	
-	// Generate hole interior faces (the thickness edges of the hole)
-	GenerateHoleInteriorFaces(Vertices, Triangles, Normals, UVs,
-		InnerBL, WallWidthDirection, WallHeightDirection,
-		OuterBL, OuterWidthDirection, OuterHeightDirection,
-		HoleLeft, HoleRight, HoleBottom, HoleTop, WallThickness);
+	GenerateSimpleRectangleHole(Vertices, Triangles, Normals, UVs,
+		InnerBL, InnerBR, InnerTR, InnerTL,
+		OuterBL, OuterBR, OuterTR, OuterTL,
+		WallWidth, WallHeight, Hole, WallThickness);
 	
 	// Draw debug sphere if World is provided
 	if (World)
@@ -876,7 +508,7 @@ void UWallUnit::GenerateWallWithRandomHole(TArray<FVector>& Vertices, TArray<int
 	UHoleGenerator::GenerateWallWithHole(Vertices, Triangles, Normals, UVs,
 		InnerBL, InnerBR, InnerTR, InnerTL,
 		OuterBL, OuterBR, OuterTR, OuterTL,
-		WallWidth, WallHeight, RandomDoor, WallThickness);
+		WallWidth, WallHeight, FResolvedHole::Compile(RandomDoor, WallWidth, WallHeight), WallThickness);
 	
 	// Draw debug sphere if World is provided
 	if (World)
@@ -896,309 +528,57 @@ AActor* UWallUnit::CreateWallWithHole(UWorld* World, const FVector& Position, co
 		return nullptr;
 	}
 
-	// HYBRID HOLE SYSTEM: Use best system for each shape type
-	if (HoleConfig.Shape == EHoleShape::Irregular)
-	{
-		// Convert FWallHoleConfig to FDoorConfig for irregular hole generation
-		FDoorConfig DoorConfig;
-		DoorConfig.bHasDoor = true;
-		DoorConfig.HoleShape = EHoleShape::Irregular;
-		DoorConfig.IrregularSize = FMath::Max(HoleConfig.Width, HoleConfig.Height); // Use larger dimension as base size
-		
-		// Configure shape parameters based on hole name for specific shapes
-		if (HoleConfig.HoleName == TEXT("Circle"))
-		{
-			DoorConfig.IrregularPoints = 24;
-			DoorConfig.Irregularity = 0.0f;
-			DoorConfig.IrregularSmoothness = 1.0f;
-			DoorConfig.IrregularRotation = 0.0f;
-			DoorConfig.RandomSeed = 12345; // Fixed seed for consistent circles
-		}
-		else if (HoleConfig.HoleName == TEXT("Triangle"))
-		{
-			DoorConfig.IrregularPoints = 3;
-			DoorConfig.Irregularity = 0.1f;
-			DoorConfig.IrregularSmoothness = 0.1f;
-			DoorConfig.IrregularRotation = 0.0f;
-			DoorConfig.RandomSeed = 11111;
-		}
-		else if (HoleConfig.HoleName == TEXT("Square"))
-		{
-			DoorConfig.IrregularPoints = 4;
-			DoorConfig.Irregularity = 0.0f;
-			DoorConfig.IrregularSmoothness = 0.2f;
-			DoorConfig.IrregularRotation = 45.0f; // Diamond orientation
-			DoorConfig.RandomSeed = 22222;
-		}
-		else if (HoleConfig.HoleName == TEXT("Hexagon"))
-		{
-			DoorConfig.IrregularPoints = 6;
-			DoorConfig.Irregularity = 0.0f;
-			DoorConfig.IrregularSmoothness = 0.5f;
-			DoorConfig.IrregularRotation = 0.0f;
-			DoorConfig.RandomSeed = 33333;
-		}
-		else if (HoleConfig.HoleName == TEXT("Star"))
-		{
-			DoorConfig.IrregularPoints = 8;
-			DoorConfig.Irregularity = 0.5f;
-			DoorConfig.IrregularSmoothness = 0.1f;
-			DoorConfig.IrregularRotation = 22.5f; // Slight rotation for star effect
-			DoorConfig.RandomSeed = 44444;
-		}
-		else if (HoleConfig.HoleName == TEXT("Flower"))
-		{
-			DoorConfig.IrregularPoints = 12;
-			DoorConfig.Irregularity = 0.4f;
-			DoorConfig.IrregularSmoothness = 0.8f;
-			DoorConfig.IrregularRotation = 15.0f;
-			DoorConfig.RandomSeed = 55555;
-		}
-		else if (HoleConfig.HoleName == TEXT("Blob"))
-		{
-			DoorConfig.IrregularPoints = 10;
-			DoorConfig.Irregularity = 0.8f;
-			DoorConfig.IrregularSmoothness = 0.9f;
-			DoorConfig.IrregularRotation = FMath::RandRange(0.0f, 360.0f);
-			DoorConfig.RandomSeed = 66666;
-		}
-		else if (HoleConfig.HoleName == TEXT("Crystal"))
-		{
-			DoorConfig.IrregularPoints = 6;
-			DoorConfig.Irregularity = 0.6f;
-			DoorConfig.IrregularSmoothness = 0.0f;
-			DoorConfig.IrregularRotation = 30.0f;
-			DoorConfig.RandomSeed = 77777;
-		}
-		else
-		{
-			// Default random irregular hole (for Row 6 random shapes)
-			DoorConfig.Irregularity = 0.7f; // Good amount of randomness for organic shapes
-			DoorConfig.IrregularPoints = 12; // Good balance between smooth and interesting
-			DoorConfig.IrregularSmoothness = 0.3f; // Some smoothing but keep organic feel
-			DoorConfig.IrregularRotation = FMath::RandRange(0.0f, 360.0f); // Random rotation
-			DoorConfig.RandomSeed = FMath::RandRange(1000, 99999); // Random seed for unique shapes
-		}
-		
-		// Convert hole config to normalized position
-		float FinalHorizontalPos, FinalVerticalPos;
-		HoleConfig.GetNormalizedPosition(WallWidth, WallHeight, FinalHorizontalPos, FinalVerticalPos);
-		
-		// Convert to offset from center for irregular hole system
-		// FinalHorizontalPos = 0.5 means center, < 0.5 means left, > 0.5 means right
-		float HorizontalOffsetMeters = (FinalHorizontalPos - 0.5f) * WallWidth;
-		DoorConfig.OffsetFromCenter = HorizontalOffsetMeters;
-		
-		// For irregular holes, we need to use a different approach
-		// Create wall with irregular hole by using the hole generator system directly
-		TArray<FVector> WallVertices;
-		TArray<int32> WallTriangles; 
-		TArray<FVector> WallNormals;
-		TArray<FVector2D> WallUVs;
-		
-		// Convert position and setup wall corners
-		float WidthCm = WallWidth * 100.0f;
-		float HeightCm = WallHeight * 100.0f;
-		float ThicknessCm = WallThickness * 100.0f;
-		
-		FVector InnerBL = FVector(-WidthCm * 0.5f, -ThicknessCm * 0.5f, -HeightCm * 0.5f);
-		FVector InnerBR = FVector(WidthCm * 0.5f, -ThicknessCm * 0.5f, -HeightCm * 0.5f);
-		FVector InnerTR = FVector(WidthCm * 0.5f, -ThicknessCm * 0.5f, HeightCm * 0.5f);
-		FVector InnerTL = FVector(-WidthCm * 0.5f, -ThicknessCm * 0.5f, HeightCm * 0.5f);
-		
-		FVector OuterBL = FVector(-WidthCm * 0.5f, ThicknessCm * 0.5f, -HeightCm * 0.5f);
-		FVector OuterBR = FVector(WidthCm * 0.5f, ThicknessCm * 0.5f, -HeightCm * 0.5f);
-		FVector OuterTR = FVector(WidthCm * 0.5f, ThicknessCm * 0.5f, HeightCm * 0.5f);
-		FVector OuterTL = FVector(-WidthCm * 0.5f, ThicknessCm * 0.5f, HeightCm * 0.5f);
-		
-		// Apply rotation
-		FTransform RotationTransform(Rotation);
-		InnerBL = RotationTransform.TransformPosition(InnerBL) + Position;
-		InnerBR = RotationTransform.TransformPosition(InnerBR) + Position;
-		InnerTR = RotationTransform.TransformPosition(InnerTR) + Position;
-		InnerTL = RotationTransform.TransformPosition(InnerTL) + Position;
-		OuterBL = RotationTransform.TransformPosition(OuterBL) + Position;
-		OuterBR = RotationTransform.TransformPosition(OuterBR) + Position;
-		OuterTR = RotationTransform.TransformPosition(OuterTR) + Position;
-		OuterTL = RotationTransform.TransformPosition(OuterTL) + Position;
-		
-		// Generate wall with irregular hole using HoleGenerator
-		UHoleGenerator::GenerateWallWithHole(WallVertices, WallTriangles, WallNormals, WallUVs,
+	// Resolve position type and shape presets once - geometry only sees the compiled hole
+	const FResolvedHole Hole = FResolvedHole::Compile(HoleConfig, WallWidth, WallHeight);
+	
+	TArray<FVector> WallVertices;
+	TArray<int32> WallTriangles; 
+	TArray<FVector> WallNormals;
+	TArray<FVector2D> WallUVs;
+	TArray<TArray<FVector>> CollisionHulls;
+	
+	GenerateCachedWallMesh(WallVertices, WallTriangles, WallNormals, WallUVs,
+		Position, Rotation, WallWidth, WallHeight, WallThickness, &Hole, World, &CollisionHulls);
+	
+	return CreateWallActorFromMesh(World, WallVertices, WallTriangles, WallNormals, WallUVs, Color, &CollisionHulls);
+}
+
+void UWallUnit::GenerateWallMeshWithResolvedHole(TArray<FVector>& OutVertices, TArray<int32>& OutTriangles, TArray<FVector>& OutNormals, TArray<FVector2D>& OutUVs,
+	const FVector& Position, const FRotator& Rotation,
+	float WallWidth, float WallHeight, float WallThickness, const FResolvedHole& Hole, UWorld* World)
+{
+	// Wall corners centered around origin, rotated around the wall's center and moved to Position in one batch
+	FVector Corners[8];
+	UWallTransform::PlaceWallCorners(Position, Rotation, WallWidth, WallHeight, WallThickness, Corners);
+	const FVector& InnerBL = Corners[0];
+	const FVector& InnerBR = Corners[1];
+	const FVector& InnerTR = Corners[2];
+	const FVector& InnerTL = Corners[3];
+	const FVector& OuterBL = Corners[4];
+	const FVector& OuterBR = Corners[5];
+	const FVector& OuterTR = Corners[6];
+	const FVector& OuterTL = Corners[7];
+	
+	if (Hole.IsPolygon())
+	{
+		// Circles and irregular shapes use the polygon hole generator
+		UHoleGenerator::GenerateWallWithHole(OutVertices, OutTriangles, OutNormals, OutUVs,
 			InnerBL, InnerBR, InnerTR, InnerTL,
 			OuterBL, OuterBR, OuterTR, OuterTL,
-			WallWidth, WallHeight, DoorConfig, WallThickness);
-		
-		// Make it double-sided by creating copies and then appending them (same as rectangular system)
-		TArray<int32> OriginalTriangles = WallTriangles;
-		TArray<FVector> OriginalNormals = WallNormals;
-		TArray<FVector2D> OriginalUVs = WallUVs;
-		
-		// Add reversed triangles (swap order for opposite normal direction)
-		for (int32 i = 0; i < OriginalTriangles.Num(); i += 3)
-		{
-			WallTriangles.Add(OriginalTriangles[i + 2]);
-			WallTriangles.Add(OriginalTriangles[i + 1]);
-			WallTriangles.Add(OriginalTriangles[i + 0]);
-		}
-		
-		// Add reversed normals for the reversed faces
-		for (int32 i = 0; i < OriginalNormals.Num(); i++)
-		{
-			WallNormals.Add(-OriginalNormals[i]);
-		}
-		
-		// Add duplicate UVs for the reversed faces
-		for (int32 i = 0; i < OriginalUVs.Num(); i++)
-		{
-			WallUVs.Add(OriginalUVs[i]);
-		}
-		
-		// Create actor and setup
-		AActor* WallActor = World->SpawnActor<AActor>();
-		UProceduralMeshComponent* WallMesh = NewObject<UProceduralMeshComponent>(WallActor);
-		WallActor->SetRootComponent(WallMesh);
-		
-		// Setup collision
-		WallMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-		WallMesh->SetCollisionObjectType(ECollisionChannel::ECC_WorldStatic);
-		WallMesh->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Block);
-		WallMesh->bUseComplexAsSimpleCollision = true;
-		WallMesh->RegisterComponent();
-		
-		// Create mesh section
-		WallMesh->CreateMeshSection(0, WallVertices, WallTriangles, WallNormals, WallUVs, 
-			TArray<FColor>(), TArray<FProcMeshTangent>(), true);
-		
-		// Apply colored material
-		UMaterialInterface* BaseMaterial = LoadObject<UMaterialInterface>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial"));
-		if (BaseMaterial)
-		{
-			UMaterialInstanceDynamic* DynMat = UMaterialInstanceDynamic::Create(BaseMaterial, WallActor);
-			if (DynMat)
-			{
-				DynMat->SetVectorParameterValue(TEXT("Color"), Color);
-				DynMat->SetVectorParameterValue(TEXT("BaseColor"), Color);
-				WallMesh->SetMaterial(0, DynMat);
-			}
-		}
-		
-		return WallActor;
+			WallWidth, WallHeight, Hole, WallThickness);
 	}
-	else if (HoleConfig.Shape == EHoleShape::Circle)
+	else
 	{
-		// ENHANCED CIRCLES: Use irregular system for perfect circles
-		FDoorConfig CircleConfig;
-		CircleConfig.bHasDoor = true;
-		CircleConfig.HoleShape = EHoleShape::Irregular;
-		CircleConfig.IrregularSize = FMath::Max(HoleConfig.Width, HoleConfig.Height);
-		CircleConfig.IrregularPoints = 16; // Good performance/quality balance
-		CircleConfig.Irregularity = 0.0f;
-		CircleConfig.IrregularSmoothness = 1.0f;
-		CircleConfig.IrregularRotation = 0.0f;
-		CircleConfig.RandomSeed = 30000;
-		
-		// Convert position and use irregular system for enhanced circles
-		float FinalHorizontalPos, FinalVerticalPos;
-		HoleConfig.GetNormalizedPosition(WallWidth, WallHeight, FinalHorizontalPos, FinalVerticalPos);
-		float HorizontalOffsetMeters = (FinalHorizontalPos - 0.5f) * WallWidth;
-		CircleConfig.OffsetFromCenter = HorizontalOffsetMeters;
-		
-		// Use same setup as irregular holes
-		TArray<FVector> WallVertices;
-		TArray<int32> WallTriangles; 
-		TArray<FVector> WallNormals;
-		TArray<FVector2D> WallUVs;
-		
-		// Setup wall corners (same as irregular system)
-		float WidthCm = WallWidth * 100.0f;
-		float HeightCm = WallHeight * 100.0f;
-		float ThicknessCm = WallThickness * 100.0f;
-		
-		FVector InnerBL = FVector(-WidthCm * 0.5f, -ThicknessCm * 0.5f, -HeightCm * 0.5f);
-		FVector InnerBR = FVector(WidthCm * 0.5f, -ThicknessCm * 0.5f, -HeightCm * 0.5f);
-		FVector InnerTR = FVector(WidthCm * 0.5f, -ThicknessCm * 0.5f, HeightCm * 0.5f);
-		FVector InnerTL = FVector(-WidthCm * 0.5f, -ThicknessCm * 0.5f, HeightCm * 0.5f);
-		
-		FVector OuterBL = FVector(-WidthCm * 0.5f, ThicknessCm * 0.5f, -HeightCm * 0.5f);
-		FVector OuterBR = FVector(WidthCm * 0.5f, ThicknessCm * 0.5f, -HeightCm * 0.5f);
-		FVector OuterTR = FVector(WidthCm * 0.5f, ThicknessCm * 0.5f, HeightCm * 0.5f);
-		FVector OuterTL = FVector(-WidthCm * 0.5f, ThicknessCm * 0.5f, HeightCm * 0.5f);
-		
-		// Apply rotation and position
-		FTransform RotationTransform(Rotation);
-		InnerBL = RotationTransform.TransformPosition(InnerBL) + Position;
-		InnerBR = RotationTransform.TransformPosition(InnerBR) + Position;
-		InnerTR = RotationTransform.TransformPosition(InnerTR) + Position;
-		InnerTL = RotationTransform.TransformPosition(InnerTL) + Position;
-		OuterBL = RotationTransform.TransformPosition(OuterBL) + Position;
-		OuterBR = RotationTransform.TransformPosition(OuterBR) + Position;
-		OuterTR = RotationTransform.TransformPosition(OuterTR) + Position;
-		OuterTL = RotationTransform.TransformPosition(OuterTL) + Position;
-		
-		// Generate enhanced circle using irregular system
-		UHoleGenerator::GenerateWallWithHole(WallVertices, WallTriangles, WallNormals, WallUVs,
+		// Rectangles use the fast 4-segment system
+		GenerateSimpleRectangleHole(OutVertices, OutTriangles, OutNormals, OutUVs,
 			InnerBL, InnerBR, InnerTR, InnerTL,
 			OuterBL, OuterBR, OuterTR, OuterTL,
-			WallWidth, WallHeight, CircleConfig, WallThickness);
-		
-		// Apply double-siding and create actor (same as irregular)
-		TArray<int32> OriginalTriangles = WallTriangles;
-		TArray<FVector> OriginalNormals = WallNormals;
-		TArray<FVector2D> OriginalUVs = WallUVs;
-		
-		for (int32 i = 0; i < OriginalTriangles.Num(); i += 3)
-		{
-			WallTriangles.Add(OriginalTriangles[i + 2]);
-			WallTriangles.Add(OriginalTriangles[i + 1]);
-			WallTriangles.Add(OriginalTriangles[i + 0]);
-		}
-		
-		for (int32 i = 0; i < OriginalNormals.Num(); i++)
-		{
-			WallNormals.Add(-OriginalNormals[i]);
-		}
-		
-		for (int32 i = 0; i < OriginalUVs.Num(); i++)
-		{
-			WallUVs.Add(OriginalUVs[i]);
-		}
+			WallWidth, WallHeight, Hole, WallThickness);
 		
-		// Create actor with enhanced circle
-		AActor* WallActor = World->SpawnActor<AActor>();
-		UProceduralMeshComponent* WallMesh = NewObject<UProceduralMeshComponent>(WallActor);
-		WallActor->SetRootComponent(WallMesh);
-		
-		WallMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-		WallMesh->SetCollisionObjectType(ECollisionChannel::ECC_WorldStatic);
-		WallMesh->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Block);
-		WallMesh->bUseComplexAsSimpleCollision = true;
-		WallMesh->RegisterComponent();
-		
-		WallMesh->CreateMeshSection(0, WallVertices, WallTriangles, WallNormals, WallUVs, 
-			TArray<FColor>(), TArray<FProcMeshTangent>(), true);
-		
-		// Apply material
-		UMaterialInterface* BaseMaterial = LoadObject<UMaterialInterface>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial"));
-		if (BaseMaterial)
+		if (World)
 		{
-			UMaterialInstanceDynamic* DynMat = UMaterialInstanceDynamic::Create(BaseMaterial, WallActor);
-			if (DynMat)
-			{
-				DynMat->SetVectorParameterValue(TEXT("Color"), Color);
-				DynMat->SetVectorParameterValue(TEXT("BaseColor"), Color);
-				WallMesh->SetMaterial(0, DynMat);
-			}
+			DrawWallCenterDebugSphere(World, InnerBL, InnerBR, InnerTR, InnerTL, OuterBL, OuterBR, OuterTR, OuterTL);
 		}
-		
-		return WallActor;
-	}
-	else
-	{
-		// For rectangle holes, use existing fast system (optimized for proper rectangles)
-		float FinalHorizontalPos, FinalVerticalPos;
-		HoleConfig.GetNormalizedPosition(WallWidth, WallHeight, FinalHorizontalPos, FinalVerticalPos);
-		return CreateCompleteWallActor(World, Position, Rotation, WallWidth, WallHeight, WallThickness, Color,
-			HoleConfig.Width, HoleConfig.Height, FinalHorizontalPos, FinalVerticalPos);
 	}
 }
 
@@ -1230,3 +610,225 @@ AActor* UWallUnit::CreateWallWithMultipleHoles(UWorld* World, const FVector& Pos
 		return CreateWallWithHole(World, Position, Rotation, WallWidth, WallHeight, WallThickness, Color, HoleConfigs[0]);
 	}
 }
+
+void UWallUnit::GenerateWallMesh(TArray<FVector>& OutVertices, TArray<int32>& OutTriangles, TArray<FVector>& OutNormals, TArray<FVector2D>& OutUVs,
+	const FVector& Position, const FRotator& Rotation,
+	float WallWidth, float WallHeight, float WallThickness, const FWallHoleConfig* HoleConfig, UWorld* World,
+	TArray<TArray<FVector>>* OutCollisionHulls)
+{
+	if (HoleConfig)
+	{
+		const FResolvedHole Hole = FResolvedHole::Compile(*HoleConfig, WallWidth, WallHeight);
+		GenerateCachedWallMesh(OutVertices, OutTriangles, OutNormals, OutUVs,
+			Position, Rotation, WallWidth, WallHeight, WallThickness, &Hole, World, OutCollisionHulls);
+	}
+	else
+	{
+		GenerateCachedWallMesh(OutVertices, OutTriangles, OutNormals, OutUVs,
+			Position, Rotation, WallWidth, WallHeight, WallThickness, nullptr, World, OutCollisionHulls);
+	}
+}
+
+void UWallUnit::GenerateCachedWallMesh(TArray<FVector>& OutVertices, TArray<int32>& OutTriangles, TArray<FVector>& OutNormals, TArray<FVector2D>& OutUVs,
+	const FVector& Position, const FRotator& Rotation,
+	float WallWidth, float WallHeight, float WallThickness, const FResolvedHole* Hole, UWorld* World,
+	TArray<TArray<FVector>>* OutCollisionHulls)
+{
+	FWallGeometryRef Geometry = UWallGeometryCache::FindOrBuild(WallWidth, WallHeight, WallThickness, Hole);
+	UWallGeometryCache::ApplyTransform(*Geometry, Position, Rotation, OutVertices, OutTriangles, OutNormals, OutUVs);
+	if (OutCollisionHulls)
+	{
+		UWallGeometryCache::TransformCollision(*Geometry, Position, Rotation, *OutCollisionHulls);
+	}
+	
+	DrawPlacementDebugSphere(World, Position, Hole);
+}
+
+void UWallUnit::DrawPlacementDebugSphere(UWorld* World, const FVector& Position, const FResolvedHole* Hole)
+{
+	// Same debug marker the uncached builders draw (solid walls and rectangle holes only)
+	if (World && !(Hole && Hole->IsPolygon()))
+	{
+		DrawDebugSphere(World, Position, 25.0f, 12, FColor::Cyan, true, -1.0f, 0, 2.0f);
+	}
+}
+
+// === SIMPLE COLLISION IMPLEMENTATIONS ===
+
+void UWallUnit::GenerateCollisionBoxes(float WallWidth, float WallHeight, float WallThickness, const FResolvedHole* Hole, TArray<FBox>& OutBoxes)
+{
+	const float WidthCm = MetersToUnrealUnits(WallWidth);
+	const float HeightCm = MetersToUnrealUnits(WallHeight);
+	const float HalfThicknessCm = MetersToUnrealUnits(WallThickness) * 0.5f;
+	
+	// Solid rectangles in wall space (cm from the bottom-left corner)
+	TArray<FBox2D> SolidRects;
+	if (Hole && Hole->IsPolygon())
+	{
+		UHoleGenerator::GenerateCollisionRects(WallWidth, WallHeight, *Hole, SolidRects);
+	}
+	else
+	{
+		// Same clamping and fallback as GenerateSimpleRectangleHole
+		const float HoleLeft = Hole ? FMath::Max(0.0f, Hole->CenterXCm - (Hole->WidthCm * 0.5f)) : 0.0f;
+		const float HoleRight = Hole ? FMath::Min(WidthCm, Hole->CenterXCm + (Hole->WidthCm * 0.5f)) : 0.0f;
+		const float HoleBottom = Hole ? FMath::Max(0.0f, Hole->CenterZCm - (Hole->HeightCm * 0.5f)) : 0.0f;
+		const float HoleTop = Hole ? FMath::Min(HeightCm, Hole->CenterZCm + (Hole->HeightCm * 0.5f)) : 0.0f;
+		
+		if (!Hole || (HoleRight - HoleLeft) < 10.0f || (HoleTop - HoleBottom) < 10.0f)
+		{
+			SolidRects.Add(FBox2D(FVector2D(0.0f, 0.0f), FVector2D(WidthCm, HeightCm)));
+		}
+		else
+		{
+			// Full-height strips beside the hole, then lintel and sill between them
+			const FBox2D Candidates[] = {
+				FBox2D(FVector2D(0.0f, 0.0f), FVector2D(HoleLeft, HeightCm)),
+				FBox2D(FVector2D(HoleRight, 0.0f), FVector2D(WidthCm, HeightCm)),
+				FBox2D(FVector2D(HoleLeft, 0.0f), FVector2D(HoleRight, HoleBottom)),
+				FBox2D(FVector2D(HoleLeft, HoleTop), FVector2D(HoleRight, HeightCm))
+			};
+			for (const FBox2D& Rect : Candidates)
+			{
+				if ((Rect.Max.X - Rect.Min.X) >= 1.0f && (Rect.Max.Y - Rect.Min.Y) >= 1.0f)
+				{
+					SolidRects.Add(Rect);
+				}
+			}
+		}
+	}
+	
+	// Wall-local space is centered on the wall
+	OutBoxes.Reset(SolidRects.Num());
+	for (const FBox2D& Rect : SolidRects)
+	{
+		OutBoxes.Add(FBox(
+			FVector(Rect.Min.X - (WidthCm * 0.5f), -HalfThicknessCm, Rect.Min.Y - (HeightCm * 0.5f)),
+			FVector(Rect.Max.X - (WidthCm * 0.5f), HalfThicknessCm, Rect.Max.Y - (HeightCm * 0.5f))));
+	}
+}
+
+void UWallUnit::SetSimpleCollision(AActor* MeshActor, const TArray<TArray<FVector>>& CollisionHulls)
+{
+	UProceduralMeshComponent* MeshComponent = MeshActor ? Cast<UProceduralMeshComponent>(MeshActor->GetRootComponent()) : nullptr;
+	if (!MeshComponent)
+	{
+		return;
+	}
+	
+	// Convert to actor-local space
+	const FVector Origin = MeshActor->GetActorLocation();
+	TArray<TArray<FVector>> LocalHulls = CollisionHulls;
+	for (TArray<FVector>& Hull : LocalHulls)
+	{
+		for (FVector& Vertex : Hull)
+		{
+			Vertex -= Origin;
+		}
+	}
+	
+	const double UploadStart = FPlatformTime::Seconds();
+	MeshComponent->bUseComplexAsSimpleCollision = false;
+	MeshComponent->SetCollisionConvexMeshes(LocalHulls);
+	GCollisionSetupSeconds += FPlatformTime::Seconds() - UploadStart;
+}
+
+void UWallUnit::GetCollisionSetupStats(int32& OutUploads, double& OutSeconds)
+{
+	OutUploads = GCollisionSetupUploads;
+	OutSeconds = GCollisionSetupSeconds;
+}
+
+void UWallUnit::ResetCollisionSetupStats()
+{
+	GCollisionSetupUploads = 0;
+	GCollisionSetupSeconds = 0.0;
+}
+
+// === MERGED ROOM MESH IMPLEMENTATIONS ===
+
+AActor* UWallUnit::CreateMergedMeshActor(UWorld* World, const FVector& Origin, bool bAsyncCooking)
+{
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// One actor and one mesh component for the whole room - each wall becomes a section
+	AActor* MeshActor = World->SpawnActor<AActor>();
+	UProceduralMeshComponent* RoomMesh = NewObject<UProceduralMeshComponent>(MeshActor);
+	MeshActor->SetRootComponent(RoomMesh);
+	
+	// Setup collision settings - standard wall configuration
+	RoomMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	RoomMesh->SetCollisionObjectType(ECollisionChannel::ECC_WorldStatic);
+	RoomMesh->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Block);
+	RoomMesh->bUseComplexAsSimpleCollision = true;
+	RoomMesh->bUseAsyncCooking = bAsyncCooking;
+	RoomMesh->RegisterComponent();
+	
+	MeshActor->SetActorLocation(Origin);
+	
+	return MeshActor;
+}
+
+bool UWallUnit::SetWallSection(AActor* MeshActor, int32 SectionIndex, const FVector& Position, const FRotator& Rotation,
+	float WallWidth, float WallHeight, float WallThickness, const FLinearColor& Color,
+	const FWallHoleConfig* HoleConfig)
+{
+	if (!MeshActor)
+	{
+		UE_LOG(LogBackRoomGenerator, Error, TEXT("SetWallSection: Actor has no procedural mesh root"));
+		return false;
+	}
+
+	TArray<FVector> WallVertices;
+	TArray<int32> WallTriangles;
+	TArray<FVector> WallNormals;
+	TArray<FVector2D> WallUVs;
+	
+	// Build in world space (keeps debug spheres where the standalone actors draw them)
+	GenerateWallMesh(WallVertices, WallTriangles, WallNormals, WallUVs,
+		Position, Rotation, WallWidth, WallHeight, WallThickness, HoleConfig, MeshActor->GetWorld());
+	
+	return SetWallSectionFromMesh(MeshActor, SectionIndex, MoveTemp(WallVertices), WallTriangles, WallNormals, WallUVs, Color);
+}
+
+bool UWallUnit::SetWallSectionFromMesh(AActor* MeshActor, int32 SectionIndex, TArray<FVector>&& WallVertices, const TArray<int32>& WallTriangles,
+	const TArray<FVector>& WallNormals, const TArray<FVector2D>& WallUVs, const FLinearColor& Color, bool bCreateCollision)
+{
+	UProceduralMeshComponent* RoomMesh = MeshActor ? Cast<UProceduralMeshComponent>(MeshActor->GetRootComponent()) : nullptr;
+	if (!RoomMesh)
+	{
+		UE_LOG(LogBackRoomGenerator, Error, TEXT("SetWallSection: Actor has no procedural mesh root"));
+		return false;
+	}
+	
+	// Convert to actor-local space
+	const FVector Origin = MeshActor->GetActorLocation();
+	for (FVector& Vertex : WallVertices)
+	{
+		Vertex -= Origin;
+	}
+	
+	// Replaces any previous geometry in this section (hole cutting rebuilds a single wall)
+	const double UploadStart = FPlatformTime::Seconds();
+	RoomMesh->CreateMeshSection(SectionIndex, WallVertices, WallTriangles, WallNormals, WallUVs, 
+		TArray<FColor>(), TArray<FProcMeshTangent>(), bCreateCollision);
+	GCollisionSetupUploads++;
+	GCollisionSetupSeconds += FPlatformTime::Seconds() - UploadStart;
+	
+	// Apply colored material (shared by every wall of this color)
+	RoomMesh->SetMaterial(SectionIndex, UWallMaterialCache::GetColorMaterial(Color));
+	
+	return true;
+}
+
+void UWallUnit::ClearWallSection(AActor* MeshActor, int32 SectionIndex)
+{
+	UProceduralMeshComponent* RoomMesh = MeshActor ? Cast<UProceduralMeshComponent>(MeshActor->GetRootComponent()) : nullptr;
+	if (RoomMesh)
+	{
+		RoomMesh->ClearMeshSection(SectionIndex);
+	}
+}
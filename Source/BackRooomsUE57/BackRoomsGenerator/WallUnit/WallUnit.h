@@ -4,6 +4,8 @@
 #include "../Types.h"
 #include "WallCommon.h"
 #include "HoleGenerator.h"
+#include "HoleDescriptor.h"
+#include "WallGeometryCache.h"
 #include "DrawDebugHelpers.h"
 
 /**
@@ -68,6 +70,26 @@ public:
 	static AActor* CreateSolidWallActor(UWorld* World, const FVector& Position, const FRotator& Rotation,
 		float WallWidth, float WallHeight, float WallThickness, const FLinearColor& Color);
 
+	// Wall actor around an already built world-space mesh (shared by the solid and holed variants)
+	// With CollisionHulls the actor gets simple convex collision and the visual mesh is not cooked
+	// bAsyncCooking cooks the collision off the game thread - the wall blocks once the cook finishes
+	static AActor* CreateWallActorFromMesh(UWorld* World, const TArray<FVector>& WallVertices, const TArray<int32>& WallTriangles,
+		const TArray<FVector>& WallNormals, const TArray<FVector2D>& WallUVs, const FLinearColor& Color,
+		const TArray<TArray<FVector>>* CollisionHulls = nullptr, bool bAsyncCooking = false);
+
+	// Empty wall actor at the origin (procedural mesh root, standard wall collision) - SetWallActorMesh gives it geometry
+	static AActor* SpawnWallActor(UWorld* World, bool bAsyncCooking = false);
+
+	// Replace a wall actor's world-space mesh, collision and color in place (pooled or re-cut walls keep their actor)
+	static bool SetWallActorMesh(AActor* WallActor, const TArray<FVector>& WallVertices, const TArray<int32>& WallTriangles,
+		const TArray<FVector>& WallNormals, const TArray<FVector2D>& WallUVs, const FLinearColor& Color,
+		const TArray<TArray<FVector>>* CollisionHulls = nullptr);
+
+	// Solid wall mesh data only (positioned, closed single-sided solid) - no actor is spawned
+	static void GenerateSolidWallMesh(TArray<FVector>& OutVertices, TArray<int32>& OutTriangles, TArray<FVector>& OutNormals, TArray<FVector2D>& OutUVs,
+		const FVector& Position, const FRotator& Rotation,
+		float WallWidth, float WallHeight, float WallThickness, UWorld* World = nullptr);
+
 	// === ADVANCED HOLE CONFIGURATION SYSTEM ===
 
 	// Create wall with single hole using advanced positioning
@@ -80,18 +102,66 @@ public:
 		float WallWidth, float WallHeight, float WallThickness, const FLinearColor& Color,
 		const TArray<FWallHoleConfig>& HoleConfigs);
 
+	// Build a positioned, closed single-sided wall mesh around a pre-resolved hole
+	static void GenerateWallMeshWithResolvedHole(TArray<FVector>& OutVertices, TArray<int32>& OutTriangles, TArray<FVector>& OutNormals, TArray<FVector2D>& OutUVs,
+		const FVector& Position, const FRotator& Rotation,
+		float WallWidth, float WallHeight, float WallThickness, const FResolvedHole& Hole, UWorld* World = nullptr);
+
+	// Positioned wall mesh from the shared geometry cache - solid when Hole is null
+	// Identical walls are built once in local space and only transformed per placement
+	static void GenerateCachedWallMesh(TArray<FVector>& OutVertices, TArray<int32>& OutTriangles, TArray<FVector>& OutNormals, TArray<FVector2D>& OutUVs,
+		const FVector& Position, const FRotator& Rotation,
+		float WallWidth, float WallHeight, float WallThickness, const FResolvedHole* Hole, UWorld* World = nullptr,
+		TArray<TArray<FVector>>* OutCollisionHulls = nullptr);
+
+	// Debug marker GenerateCachedWallMesh draws at a wall placement (game thread only)
+	static void DrawPlacementDebugSphere(UWorld* World, const FVector& Position, const FResolvedHole* Hole);
+
+	// Positioned wall mesh data - solid when HoleConfig is null, otherwise cut around the compiled hole
+	static void GenerateWallMesh(TArray<FVector>& OutVertices, TArray<int32>& OutTriangles, TArray<FVector>& OutNormals, TArray<FVector2D>& OutUVs,
+		const FVector& Position, const FRotator& Rotation,
+		float WallWidth, float WallHeight, float WallThickness, const FWallHoleConfig* HoleConfig, UWorld* World = nullptr,
+		TArray<TArray<FVector>>* OutCollisionHulls = nullptr);
+
+	// === SIMPLE COLLISION ===
+
+	// Solid parts of a wall as boxes in wall-local space (centered, X = width, Y = thickness, Z = height)
+	// One box for a solid wall, the strips around a rectangle hole, strips plus merged cells for a polygon hole
+	static void GenerateCollisionBoxes(float WallWidth, float WallHeight, float WallThickness, const FResolvedHole* Hole, TArray<FBox>& OutBoxes);
+
+	// Replace the collision of a mesh actor with convex hulls given in world space (visual sections are left alone)
+	static void SetSimpleCollision(AActor* MeshActor, const TArray<TArray<FVector>>& CollisionHulls);
+
+	// Time spent uploading wall sections and creating their collision since the last reset (game thread)
+	static void GetCollisionSetupStats(int32& OutUploads, double& OutSeconds);
+	static void ResetCollisionSetupStats();
+
+	// === MERGED ROOM MESH ===
+
+	// Spawn an empty mesh actor at Origin - walls are added to it as mesh sections
+	// bAsyncCooking cooks section collision off the game thread
+	static AActor* CreateMergedMeshActor(UWorld* World, const FVector& Origin, bool bAsyncCooking = false);
+
+	// Build one wall (solid when HoleConfig is null) into a section of a merged mesh actor
+	// Position is in world space, vertices are stored relative to the actor location
+	static bool SetWallSection(AActor* MeshActor, int32 SectionIndex, const FVector& Position, const FRotator& Rotation,
+		float WallWidth, float WallHeight, float WallThickness, const FLinearColor& Color,
+		const FWallHoleConfig* HoleConfig = nullptr);
+
+	// Same, for a wall mesh that was already built in world space
+	// bCreateCollision = false when the actor uses SetSimpleCollision instead of the section triangles
+	static bool SetWallSectionFromMesh(AActor* MeshActor, int32 SectionIndex, TArray<FVector>&& WallVertices, const TArray<int32>& WallTriangles,
+		const TArray<FVector>& WallNormals, const TArray<FVector2D>& WallUVs, const FLinearColor& Color, bool bCreateCollision = true);
+
+	// Remove a wall section from a merged mesh actor (wall removal / before re-cutting)
+	static void ClearWallSection(AActor* MeshActor, int32 SectionIndex);
+
 private:
 	// Fast simple rectangle hole generation for performance
 	static void GenerateSimpleRectangleHole(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
 		FVector InnerBL, FVector InnerBR, FVector InnerTR, FVector InnerTL,
 		FVector OuterBL, FVector OuterBR, FVector OuterTR, FVector OuterTL,
-		float WallWidth, float WallHeight, const FDoorConfig& Door, float WallThickness);
-	
-	// Generate the interior faces that show wall thickness around holes
-	static void GenerateHoleInteriorFaces(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector>& Normals, TArray<FVector2D>& UVs,
-		FVector InnerBL, FVector WallWidthDirection, FVector WallHeightDirection,
-		FVector OuterBL, FVector OuterWidthDirection, FVector OuterHeightDirection,
-		float HoleLeft, float HoleRight, float HoleBottom, float HoleTop, float WallThickness);
+		float WallWidth, float WallHeight, const FResolvedHole& Hole, float WallThickness);
 	
 	// Debug function to show wall center
 	static void DrawWallCenterDebugSphere(UWorld* World, 